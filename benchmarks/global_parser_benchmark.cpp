@@ -0,0 +1,110 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the numeric parser<T> against the boost::lexical_cast path it replaced
+
+#include "arg_router/parsing/global_parser.hpp"
+
+#include <boost/lexical_cast/try_lexical_convert.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr auto num_tokens = std::size_t{1'000'000};
+constexpr auto num_runs = 5;
+
+template <typename T>
+std::vector<std::string> generate_tokens()
+{
+    auto engine = std::mt19937_64{42};  // NOLINT(*-magic-numbers)
+    auto tokens = std::vector<std::string>{};
+    tokens.reserve(num_tokens);
+
+    for (auto i = std::size_t{0}; i < num_tokens; ++i) {
+        if constexpr (std::is_floating_point_v<T>) {
+            auto dist = std::uniform_real_distribution<T>{-1e6, 1e6};  // NOLINT(*-magic-numbers)
+            auto str = std::ostringstream{};
+            str << std::setprecision(std::numeric_limits<T>::digits10) << dist(engine);
+            tokens.push_back(str.str());
+        } else {
+            auto dist = std::uniform_int_distribution<T>{std::numeric_limits<T>::min(),
+                                                         std::numeric_limits<T>::max()};
+            tokens.push_back(std::to_string(dist(engine)));
+        }
+    }
+
+    return tokens;
+}
+
+// Returns the fastest run time in nanoseconds per token
+template <typename T, typename Fn>
+double time_it(const std::vector<std::string>& tokens, Fn&& fn)
+{
+    auto best = std::numeric_limits<double>::max();
+    for (auto run = 0; run < num_runs; ++run) {
+        // Accumulate the results so the optimiser cannot remove the parsing
+        auto sum = T{};
+        const auto start = std::chrono::steady_clock::now();
+        for (const auto& token : tokens) {
+            sum += fn(token);
+        }
+        const auto duration = std::chrono::steady_clock::now() - start;
+
+        volatile auto sink = sum;
+        static_cast<void>(sink);
+
+        const auto ns = std::chrono::duration<double, std::nano>{duration}.count();
+        best = std::min(best, ns / static_cast<double>(tokens.size()));
+    }
+
+    return best;
+}
+
+template <typename T>
+void benchmark(std::string_view type_name)
+{
+    const auto tokens = generate_tokens<T>();
+
+    const auto parser_ns =
+        time_it<T>(tokens, [](const auto& token) { return arg_router::parser<T>::parse(token); });
+    const auto boost_ns = time_it<T>(tokens, [](const auto& token) {
+        auto result = T{};
+        if (!boost::conversion::try_lexical_convert(token, result)) {
+            std::cerr << "Boost failed to parse: " << token << std::endl;
+        }
+        return result;
+    });
+
+    std::cout << std::left << std::setw(16) << type_name << std::right << std::fixed
+              << std::setprecision(2) << std::setw(12) << parser_ns << std::setw(12) << boost_ns
+              << std::setw(10) << (boost_ns / parser_ns) << "x" << std::endl;
+}
+}  // namespace
+
+int main()
+{
+    std::cout << "Nanoseconds per token, best of " << num_runs << " runs over " << num_tokens
+              << " tokens" << std::endl;
+    std::cout << std::left << std::setw(16) << "Type" << std::right << std::setw(12) << "parser<T>"
+              << std::setw(12) << "Boost" << std::setw(11) << "Speedup" << std::endl;
+
+    benchmark<int>("int");
+    benchmark<std::int64_t>("std::int64_t");
+    benchmark<std::uint64_t>("std::uint64_t");
+    benchmark<float>("float");
+    benchmark<double>("double");
+
+    return EXIT_SUCCESS;
+}
@@ -35,26 +35,37 @@ path_prefixer(TEST_SRCS
     multi_lang/root_test.cpp
     multi_lang/root_wrapper_test.cpp
     multi_lang/string_selector_test.cpp
+    parse_session_test.cpp
+    parsing/config_table_test.cpp
     parsing/dynamic_token_adapter_test.cpp
     parsing/global_parser_test.cpp
+    parsing/name_dispatch_table_test.cpp
     parsing/parse_target_test.cpp
     parsing/parsing_test.cpp
     parsing/pre_parse_data_test.cpp
+    parsing/shell_tokenizer_test.cpp
+    parsing/token_list_test.cpp
     policy/alias_test.cpp
+    policy/bind_to_test.cpp
     policy/colour_help_formatter_test.cpp
+    policy/compiled_grammar_test.cpp
+    policy/config_file_test.cpp
     policy/custom_parser_test.cpp
     policy/default_help_formatter_test.cpp
     policy/default_value_test.cpp
     policy/dependent_test.cpp
     policy/description_test.cpp
     policy/display_name_test.cpp
+    policy/env_fallback_test.cpp
     policy/error_name_test.cpp
     policy/exception_translator_test.cpp
+    policy/lazy_value_test.cpp
     policy/long_name_test.cpp
     policy/min_max_count_test.cpp
     policy/min_max_value_ct_test.cpp
     policy/min_max_value_t_test.cpp
     policy/required_test.cpp
+    policy/response_file_test.cpp
     policy/router_test.cpp
     policy/runtime_enable_test.cpp
     policy/short_form_expander_test.cpp
@@ -67,6 +78,7 @@ path_prefixer(TEST_SRCS
     root_tests/basic_test.cpp
     root_tests/death_test.cpp
     root_tests/positional_arg_test.cpp
+    root_tests/thread_safety_test.cpp
     root_tests/variable_length_test.cpp
     root_tests/top_level_test.cpp
     root_test.cpp
@@ -78,7 +90,11 @@ path_prefixer(TEST_SRCS
     utility/compile_time_optional_test.cpp
     utility/dynamic_string_view_test.cpp
     utility/exception_formatter_test.cpp
+    utility/lazy_test.cpp
+    utility/mapped_file_test.cpp
+    utility/resource_allocator_test.cpp
     utility/result_test.cpp
+    utility/small_vector_test.cpp
     utility/string_to_policy_test.cpp
     utility/string_view_ops_test.cpp
     utility/tree_recursor_test.cpp
@@ -91,10 +107,16 @@ path_prefixer(TEST_SRCS
     utility/utf8_test.cpp
 )
 
+# Built as a separate executable as it changes AR_ALLOCATOR, which alters the layout of non-template
+# types
+path_prefixer(RESOURCE_TEST_SRCS
+    resource_parse_test.cpp
+)
+
 # Format just the unit test files
 create_clangformat_target(
     NAME clangformat_test
-    SOURCES ${TEST_HEADERS} ${TEST_SRCS}
+    SOURCES ${TEST_HEADERS} ${TEST_SRCS} ${RESOURCE_TEST_SRCS}
 )
 
 # Translation generator unit test input files
@@ -166,3 +188,28 @@ target_compile_definitions(arg_router_test PRIVATE
 )
 
 add_test(NAME arg_router_test COMMAND arg_router_test -l message)
+
+add_executable(arg_router_resource_test ${TEST_HEADERS} ${RESOURCE_TEST_SRCS})
+add_dependencies(arg_router_resource_test clangformat_test arg_router)
+
+set_target_properties(arg_router_resource_test PROPERTIES CXX_EXTENSIONS OFF)
+if(NOT DEFINED CMAKE_CXX_STANDARD)
+    target_compile_features(arg_router_resource_test PUBLIC cxx_std_20)
+endif()
+
+configure_test_build(arg_router_resource_test)
+add_clangtidy_to_target(arg_router_resource_test)
+add_santizers_to_target(arg_router_resource_test)
+
+target_include_directories(arg_router_resource_test
+    PRIVATE "${CMAKE_CURRENT_SOURCE_DIR}"
+)
+
+target_link_libraries(arg_router_resource_test
+    PRIVATE arg_router
+    PUBLIC Threads::Threads
+)
+
+target_compile_definitions(arg_router_resource_test PRIVATE UNIT_TEST_BUILD)
+
+add_test(NAME arg_router_resource_test COMMAND arg_router_resource_test -l message)
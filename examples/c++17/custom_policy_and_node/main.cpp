@@ -134,7 +134,7 @@ public:
      * correct type
      */
     template <typename Validator, bool HasTarget, typename... Parents>
-    [[nodiscard]] std::optional<ar::parsing::parse_target> pre_parse(
+    [[nodiscard]] ar::parsing::pre_parse_target_result pre_parse(
         ar::parsing::pre_parse_data<Validator, HasTarget> pre_parse_data,
         const Parents&... parents) const
 
@@ -59,7 +59,7 @@ public:
     }
 
     template <typename Validator, bool HasTarget, typename... Parents>
-    [[nodiscard]] std::optional<parsing::parse_target> pre_parse(
+    [[nodiscard]] parsing::pre_parse_target_result pre_parse(
         parsing::pre_parse_data<Validator, HasTarget> pre_parse_data,
         const Parents&... parents) const
 
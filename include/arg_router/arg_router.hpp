@@ -10,9 +10,13 @@
 #include "arg_router/multi_lang/root_wrapper.hpp"
 #include "arg_router/multi_lang/string_selector.hpp"
 #include "arg_router/policy/colour_help_formatter.hpp"
+#include "arg_router/policy/compiled_grammar.hpp"
+#include "arg_router/policy/config_file.hpp"
 #include "arg_router/policy/custom_parser.hpp"
 #include "arg_router/policy/description.hpp"
+#include "arg_router/policy/env_fallback.hpp"
 #include "arg_router/policy/min_max_value.hpp"
+#include "arg_router/policy/response_file.hpp"
 #include "arg_router/policy/token_end_marker.hpp"
 #include "arg_router/policy/validator.hpp"
 #include "arg_router/policy/validator_rule_utilities.hpp"
@@ -32,10 +32,15 @@
 #    define AR_UTF8_TRAILING_WINDOW_SIZE 16
 #endif
 
+#ifndef AR_MAX_TREE_DEPTH
+#    define AR_MAX_TREE_DEPTH 16
+#endif
+
 #ifndef AR_DISABLE_CPP20_STRINGS
 #    define AR_DISABLE_CPP20_STRINGS false
 #endif
 
+#include "arg_router/utility/resource_allocator.hpp"
 #include "arg_router/utility/utf8.hpp"
 
 /** Build configuration-defined constants.
@@ -64,11 +69,22 @@ static_assert(utility::utf8::count(long_prefix) >= utility::utf8::count(short_pr
 
 /** Allocator for all STL types.
  *
+ * Set <TT>AR_ALLOCATOR</TT> to utility::resource_allocator to allow the memory resource to be
+ * specified per root_t::parse call.
  * @tparam T Type to allocate for
  */
 template <typename T>
 using allocator = AR_ALLOCATOR<T>;
 
+/** Maximum depth of the node tree, i.e. the maximum number of nodes from the root to a leaf
+ * (inclusive).
+ *
+ * This sets the size of the fixed ancestry storage in parsing::parse_target.
+ */
+constexpr auto max_tree_depth = std::size_t{AR_MAX_TREE_DEPTH};
+
+static_assert(max_tree_depth > 0, "Maximum tree depth must be greater than zero");
+
 #if (__cplusplus >= 202002L) && !AR_DISABLE_CPP20_STRINGS
 #    define AR_ENABLE_CPP20_STRINGS
 #endif
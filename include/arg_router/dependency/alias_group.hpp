@@ -103,22 +103,21 @@ public:
      * @tparam Parents Pack of parent tree nodes in ascending ancestry order
      * @param pre_parse_data Pre-parse data aggregate
      * @param parents Parent node instances
-     * @return Non-empty if the leading tokens in @a args are consumable by this
-     * node
-     * @exception multi_lang_exception Thrown if any of the child pre-parse implementations have
-     * returned an exception
+     * @return Non-empty target if the leading tokens in @a args are consumable by this node, or
+     * the error if any of the child pre-parse implementations returned one
      */
     template <typename Validator, bool HasTarget, typename... Parents>
-    [[nodiscard]] std::optional<parsing::parse_target> pre_parse(
+    [[nodiscard]] parsing::pre_parse_target_result pre_parse(
         parsing::pre_parse_data<Validator, HasTarget> pre_parse_data,
         const Parents&... parents) const
     {
-        auto found = std::optional<parsing::parse_target>{};
+        auto found = parsing::pre_parse_target_result{std::nullopt};
         utility::tuple_iterator(
             [&](auto /*i*/, const auto& child) {
-                if (!found) {
-                    found = child.pre_parse(pre_parse_data, parents...);
+                if (found.has_error() || *found.get_if()) {
+                    return;
                 }
+                found = child.pre_parse(pre_parse_data, parents...);
             },
             this->children());
 
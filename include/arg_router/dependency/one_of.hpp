@@ -75,32 +75,28 @@ public:
      * @tparam Parents Pack of parent tree nodes in ascending ancestry order
      * @param pre_parse_data Pre-parse data aggregate
      * @param parents Parent node instances
-     * @return Non-empty if the leading tokens in @a args are consumable by this node
-     * @exception multi_lang_exception Thrown if any of the child pre-parse implementations have
-     * returned an exception, or if called more than once resolving to different children (i.e.
-     * a "one of" violation)
+     * @return Non-empty target if the leading tokens in @a args are consumable by this node, or
+     * the error if any of the child pre-parse implementations returned one, or if the parent's
+     * target already has a sub-target for a different child (i.e. a "one of" violation)
      */
     template <typename Validator, bool HasTarget, typename... Parents>
-    [[nodiscard]] std::optional<parsing::parse_target> pre_parse(
+    [[nodiscard]] parsing::pre_parse_target_result pre_parse(
         parsing::pre_parse_data<Validator, HasTarget> pre_parse_data,
         const Parents&... parents) const
     {
         // We need to wrap the pre_parse_data validator so that we can catch child type mismatches
         // before the caller's validation, otherwise the user can get misleading error messages
-        const auto validator = [&](const auto& child, const auto&... parents) {
-            using child_type = std::decay_t<decltype(child)>;
-
-            auto type_hash = utility::type_hash<child_type>();
-            if (last_typeid_) {
-                if (type_hash != *last_typeid_) {
-                    throw multi_lang_exception{error_code::one_of_selected_type_mismatch,
-                                               parsing::node_token_type<one_of_t>()};
+        const auto validator = [&](const auto& child,
+                                   const auto&... parents) -> parsing::pre_parse_result {
+            if constexpr (HasTarget) {
+                auto selection = check_selection<std::decay_t<decltype(child)>>(
+                    pre_parse_data.target());
+                if (selection.has_error()) {
+                    return selection;
                 }
-            } else {
-                last_typeid_ = type_hash;
             }
 
-            return pre_parse_data.validator()(child, parents...);
+            return parsing::validation_result(pre_parse_data.validator()(child, parents...));
         };
         auto wrapper =
             std::optional<parsing::pre_parse_data<std::decay_t<decltype(validator)>, HasTarget>>{};
@@ -111,15 +107,20 @@ public:
             wrapper = parsing::pre_parse_data{pre_parse_data.args(), validator};
         }
 
-        auto found = std::optional<parsing::parse_target>{};
+        auto found = parsing::pre_parse_target_result{std::nullopt};
         utility::tuple_iterator(
             [&](auto /*i*/, const auto& child) {
-                if (!found) {
-                    found = child.pre_parse(*wrapper, parents...);
-                    if (found) {
-                        // There is no requirement to use pre_parse_data validation, so we also
-                        // need to manually check here
-                        validator(child, parents...);
+                if (found.has_error() || *found.get_if()) {
+                    return;
+                }
+
+                found = child.pre_parse(*wrapper, parents...);
+                if (found && *found.get_if()) {
+                    // There is no requirement to use pre_parse_data validation, so we also need
+                    // to manually check here
+                    const auto validation = validator(child, parents...);
+                    if (const auto* e = validation.get_error_if()) {
+                        found = *e;
                     }
                 }
             },
@@ -129,7 +130,31 @@ public:
     }
 
 private:
-    mutable std::optional<std::size_t> last_typeid_;
+    // The selection is found in the parent's target rather than being stored in this node, as the
+    // target only lives for the duration of a single parse call
+    template <typename Child>
+    [[nodiscard]] static parsing::pre_parse_result check_selection(
+        const parsing::parse_target& parent_target)
+    {
+        for (const auto& sub_target : parent_target.sub_targets()) {
+            const auto hash = sub_target.node_type();
+            if (hash == utility::type_hash<Child>()) {
+                continue;
+            }
+
+            auto is_other_child = false;
+            utility::tuple_type_iterator<children_type>([&](auto i) {
+                using other_child_type = std::tuple_element_t<i, children_type>;
+                is_other_child = is_other_child || (hash == utility::type_hash<other_child_type>());
+            });
+            if (is_other_child) {
+                return multi_lang_exception{error_code::one_of_selected_type_mismatch,
+                                            parsing::node_token_type<one_of_t>()};
+            }
+        }
+
+        return parsing::pre_parse_action::valid_node;
+    }
 };
 
 /** Constructs a one_of_t with the given policies and children.
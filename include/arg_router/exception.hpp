@@ -60,6 +60,9 @@ enum class error_code : std::size_t {
                                     ///< not match the current selection
     missing_value_separator,        ///< A token that expects a value separator character was not
                                     ///< given one on the command line
+    cannot_read_response_file,      ///< A response file token names a file that cannot be read
+    unterminated_quote,             ///< A quoted string is missing its closing quote
+    invalid_config_line,            ///< A line of a configuration file cannot be parsed
 };
 
 /** Default error code translations in en_GB.
@@ -98,7 +101,13 @@ struct default_error_code_translations {
         std::pair<traits::integral_constant<error_code::one_of_selected_type_mismatch>,
                   AR_STRING("Only one argument from a \"One Of\" can be used at once")>,
         std::pair<traits::integral_constant<error_code::missing_value_separator>,
-                  AR_STRING("Expected a value separator")>>;
+                  AR_STRING("Expected a value separator")>,
+        std::pair<traits::integral_constant<error_code::cannot_read_response_file>,
+                  AR_STRING("Cannot read response file")>,
+        std::pair<traits::integral_constant<error_code::unterminated_quote>,
+                  AR_STRING("Unterminated quote")>,
+        std::pair<traits::integral_constant<error_code::invalid_config_line>,
+                  AR_STRING("Invalid config file line")>>;
 };
 
 /** Used internally by the library (and node developers) to indicate failure.
@@ -115,7 +115,7 @@ public:
     }
 
     template <typename Validator, bool HasTarget, typename... Parents>
-    [[nodiscard]] std::optional<parsing::parse_target> pre_parse(
+    [[nodiscard]] parsing::pre_parse_target_result pre_parse(
         parsing::pre_parse_data<Validator, HasTarget> pre_parse_data,
         const Parents&... parents) const
 
@@ -233,7 +233,7 @@ private:
         "Help only supports policies with pre-parse and routing phases");
 
     template <typename Node, typename TargetFn>
-    static void find_help_target(vector<parsing::token_type>& tokens,
+    static void find_help_target(parsing::token_buffer& tokens,
                                  const Node& node,
                                  const TargetFn& fn)
     {
@@ -260,7 +260,7 @@ private:
                 // Help tokens aren't pre-parsed by the target nodes (as they would fail if missing
                 // any required value tokens), so we have just use the prefix to generate a
                 // token_type from them, as they all of a prefix_type of none
-                const auto token = parsing::get_token_type(child, tokens.front().name);
+                const auto token = parsing::get_token_type(child, tokens.front());
                 if (!result && parsing::match<child_type>(token)) {
                     result = true;
                     tokens.erase(tokens.begin());
@@ -4,16 +4,23 @@
 
 #pragma once
 
+#include "arg_router/parsing/name_dispatch_table.hpp"
 #include "arg_router/parsing/unknown_argument_handling.hpp"
+#include "arg_router/policy/bind_to.hpp"
+#include "arg_router/policy/compiled_grammar.hpp"
+#include "arg_router/policy/config_file.hpp"
 #include "arg_router/policy/description.hpp"
+#include "arg_router/policy/env_fallback.hpp"
 #include "arg_router/policy/error_name.hpp"
 #include "arg_router/policy/multi_stage_value.hpp"
 #include "arg_router/policy/no_result_value.hpp"
 #include "arg_router/policy/none_name.hpp"
 #include "arg_router/tree_node.hpp"
+#include "arg_router/utility/lazy.hpp"
 #include "arg_router/utility/string_to_policy.hpp"
-#include "arg_router/utility/tree_recursor.hpp"
 
+#include <algorithm>
+#include <array>
 #include <bitset>
 
 namespace arg_router
@@ -88,9 +95,80 @@ class mode_t :
             boost::mp11::mp_bind<traits::get_value_type, boost::mp11::_1>>::template fn,
         T>;
 
+    // Indices of the non-skip_tag elements of ResultsType
+    template <typename ResultsType>
+    struct is_result_index {
+        template <typename I>
+        using fn = boost::mp11::mp_not<is_skip_tag<boost::mp11::mp_at<ResultsType, I>>>;
+    };
+    template <typename ResultsType>
+    using result_indices =
+        boost::mp11::mp_copy_if_q<boost::mp11::mp_iota<boost::mp11::mp_size<ResultsType>>,
+                                  is_result_index<ResultsType>>;
+
     template <typename Child>
     using is_child_mode = traits::is_specialisation_of<Child, mode_t>;
 
+    // A parsable node that can be a sub-target of this mode, along with the index of the child
+    // whose subtree it is in, and the child indices path to it from this mode
+    template <std::size_t ChildIndex, typename Node, std::size_t... Path>
+    struct parse_entry {
+        constexpr static auto child_index = ChildIndex;
+        using node_type = Node;
+        using path_type = std::index_sequence<Path...>;
+    };
+
+    template <std::size_t ChildIndex, typename Node, typename Path>
+    struct collect_parse_entries;
+
+    template <std::size_t ChildIndex, typename Node, std::size_t... Path>
+    struct collect_parse_entries<ChildIndex, Node, std::index_sequence<Path...>> {
+        template <typename I>
+        using child_entries = typename collect_parse_entries<
+            ChildIndex,
+            std::tuple_element_t<I::value, typename Node::children_type>,
+            std::index_sequence<Path..., I::value>>::type;
+
+        using self_type =
+            boost::mp11::mp_if_c<traits::has_parse_method_v<Node>,
+                                 boost::mp11::mp_list<parse_entry<ChildIndex, Node, Path...>>,
+                                 boost::mp11::mp_list<>>;
+
+        using type = boost::mp11::mp_apply<
+            boost::mp11::mp_append,
+            boost::mp11::mp_push_front<
+                boost::mp11::mp_transform<
+                    child_entries,
+                    boost::mp11::mp_iota_c<std::tuple_size_v<typename Node::children_type>>>,
+                self_type>>;
+    };
+
+    template <typename I>
+    using child_parse_entries = typename collect_parse_entries<
+        I::value,
+        std::tuple_element_t<I::value, typename mode_t::children_type>,
+        std::index_sequence<I::value>>::type;
+
+    // Child modes are skipped as they are never sub-targets of this mode
+    template <typename I>
+    using non_mode_child_parse_entries = boost::mp11::mp_eval_if_c<
+        is_child_mode<std::tuple_element_t<I::value, typename mode_t::children_type>>::value,
+        boost::mp11::mp_list<>,
+        child_parse_entries,
+        I>;
+
+    using parse_entries_type = boost::mp11::mp_apply<
+        boost::mp11::mp_append,
+        boost::mp11::mp_transform<
+            non_mode_child_parse_entries,
+            boost::mp11::mp_iota_c<std::tuple_size_v<typename mode_t::children_type>>>>;
+
+    template <typename Entry>
+    using parse_entry_node_type = typename Entry::node_type;
+
+    using parse_entry_nodes_type =
+        boost::mp11::mp_transform<parse_entry_node_type, parse_entries_type>;
+
 public:
     using typename parent_type::policies_type;
     using typename parent_type::children_type;
@@ -103,6 +181,20 @@ public:
     /** True if this mode is anonymous. */
     constexpr static bool is_anonymous = !traits::has_none_name_method_v<mode_t>;
 
+    /** Dense index of @a Node amongst the parsable nodes that can be sub-targets of this mode, or
+     * parsing::parse_target::no_index if it is not one of them.
+     *
+     * parsing::parse_target uses this to tag the sub-targets of this mode, so that their results
+     * can be dispatched in constant time.
+     * @tparam Node Node type
+     */
+    template <typename Node>
+    constexpr static std::size_t node_index =
+        (boost::mp11::mp_find<parse_entry_nodes_type, Node>::value ==
+         boost::mp11::mp_size<parse_entry_nodes_type>::value)
+            ? parsing::parse_target::no_index
+            : boost::mp11::mp_find<parse_entry_nodes_type, Node>::value;
+
     static_assert(!is_anonymous || !traits::has_description_method_v<mode_t>,
                   "Anonymous modes cannot have a description policy");
     static_assert(is_anonymous || (!is_anonymous && !traits::has_error_name_method_v<mode_t>),
@@ -176,12 +268,12 @@ public:
      * @tparam Parents Pack of parent tree nodes in ascending ancestry order
      * @param pre_parse_data Pre-parse data aggregate
      * @param parents Parent node instances
-     * @return Non-empty if the leading tokens in @a args are consumable by this node
-     * @exception multi_lang_exception Thrown if a child node cannot be found, or a delegated child
-     * pre-parse policy throws
+     * @return Non-empty target if the leading tokens in @a args are consumable by this node, or
+     * the error if a child node cannot be found, a child is repeated, or a delegated child
+     * pre-parse returns an error
      */
     template <typename Validator, bool HasTarget, typename... Parents>
-    [[nodiscard]] std::optional<parsing::parse_target> pre_parse(
+    [[nodiscard]] parsing::pre_parse_target_result pre_parse(
         parsing::pre_parse_data<Validator, HasTarget> pre_parse_data,
         const Parents&... parents) const
     {
@@ -212,6 +304,12 @@ private:
     static_assert(!is_anonymous || boost::mp11::mp_none_of<children_type, is_child_mode>::value,
                   "Anonymous mode cannot have a child mode");
 
+    static_assert(!algorithm::has_specialisation_v<policy::bind_to_t,
+                                                   typename parent_type::policies_type> ||
+                      !std::is_void_v<typename parent_type::template phase_finder_t<
+                          policy::has_routing_phase_method>>,
+                  "Mode with bind_to must have a router");
+
     static_assert(!parent_type::template any_phases_v<value_type,
                                                       policy::has_parse_phase_method,
                                                       policy::has_validation_phase_method,
@@ -229,8 +327,32 @@ private:
                                           child_has_routing_phase>::value,
                   "Non-mode children cannot have routing");
 
+    using dispatch_table_type = parsing::name_dispatch_table<children_type>;
+
+    constexpr static auto num_children = std::tuple_size_v<children_type>;
+
+    // Index of the first non-mode child that has to be tried for every token, or num_children if
+    // there isn't one
+    template <std::size_t... I>
+    [[nodiscard]] constexpr static std::size_t first_undispatchable(
+        std::index_sequence<I...> /*indices*/) noexcept
+    {
+        const auto undispatchable = std::array<bool, sizeof...(I)>{
+            (!is_child_mode<std::tuple_element_t<I, children_type>>::value &&
+             !dispatch_table_type::template is_dispatchable<I>)...};
+        for (auto i = std::size_t{0}; i < undispatchable.size(); ++i) {
+            if (undispatchable[i]) {
+                return i;
+            }
+        }
+        return undispatchable.size();
+    }
+
+    constexpr static auto first_undispatchable_child =
+        first_undispatchable(std::make_index_sequence<num_children>{});
+
     template <typename Validator, bool HasTarget, typename DerivedMode, typename... Parents>
-    [[nodiscard]] std::optional<parsing::parse_target> pre_parse_impl(
+    [[nodiscard]] parsing::pre_parse_target_result pre_parse_impl(
         parsing::pre_parse_data<Validator, HasTarget> pre_parse_data,
         const DerivedMode& this_mode,
         const Parents&... parents) const
@@ -250,35 +372,51 @@ private:
         // the default implementation for this
         if constexpr (!is_anonymous) {
             auto match = parent_type::pre_parse(pre_parse_data, this_mode, parents...);
-            if (!match) {
+            if (match.has_error() || !*match.get_if()) {
                 return match;
             }
 
             // Check if the next token (if any) matches a child mode.  If so, delegate to that
             if (!args.empty()) {
-                match.reset();
+                auto child_match = parsing::pre_parse_target_result{std::nullopt};
+                const auto candidates = dispatch_table_type::find(args.front());
                 utility::tuple_iterator(
-                    [&](auto /*i*/, const auto& child) {
+                    [&]([[maybe_unused]] auto i, const auto& child) {
                         using child_type = std::decay_t<decltype(child)>;
                         if constexpr (traits::is_specialisation_of_v<child_type, mode_t>) {
-                            if (!match) {
-                                match = child.pre_parse(pre_parse_data, this_mode, parents...);
+                            if constexpr (dispatch_table_type::template is_dispatchable<i>) {
+                                if (!candidates[i]) {
+                                    return;
+                                }
+                            }
+                            if (!is_final(child_match)) {
+                                child_match =
+                                    child.pre_parse(pre_parse_data, this_mode, parents...);
                             }
                         }
                     },
                     this->children());
-                if (match) {
-                    return match;
+                if (is_final(child_match)) {
+                    return child_match;
                 }
             }
         }
 
-        if (!pre_parse_data.validator()(this_mode, parents...)) {
-            return {};
+        const auto validation =
+            parsing::validation_result(pre_parse_data.validator()(this_mode, parents...));
+        if (const auto* e = validation.get_error_if()) {
+            return *e;
+        }
+        if (validation == parsing::pre_parse_action::skip_node) {
+            return std::optional<parsing::parse_target>{};
         }
 
         auto target = parsing::parse_target{this_mode, parents...};
 
+        // Most command lines hit each child at most once, so this is normally the only allocation
+        // the sub-targets need
+        target.reserve_sub_targets(std::min(args.size(), std::tuple_size_v<children_type>));
+
         // Iterate over the tokens until consumed, skipping children already processed that cannot
         // be repeated on the command line
         auto matched = std::bitset<std::tuple_size_v<children_type>>{};
@@ -286,55 +424,95 @@ private:
             // Take a copy of the front token for the error messages
             const auto front_token = args.front();
 
-            auto match = std::optional<parsing::parse_target>{};
-            utility::tuple_iterator(
-                [&]([[maybe_unused]] auto i, const auto& child) {
-                    using child_type = std::decay_t<decltype(child)>;
+            auto match = parsing::pre_parse_target_result{std::nullopt};
+            const auto try_child = [&](auto i, const auto& child) {
+                using child_type = std::decay_t<decltype(child)>;
 
-                    // The token(s) have been processed so skip over any remaining children
-                    if (match) {
-                        return;
+                // Skip past modes, as they're handled earlier
+                if constexpr (!traits::is_specialisation_of_v<child_type, mode_t>) {
+                    match = child.pre_parse(
+                        parsing::pre_parse_data{
+                            args,
+                            target,
+                            [&](const auto& real_child, const auto&...) {
+                                using real_child_type = std::decay_t<decltype(real_child)>;
+                                return verify_match<real_child_type>(matched[i], front_token);
+                            }},
+                        this_mode,
+                        parents...);
+
+                    // Update the matched bitset
+                    if (is_final(match) && !match.has_error()) {
+                        matched.set(i);
                     }
+                }
+            };
+
+            // With a compiled grammar, if the lowest child that may own the front token would be
+            // the first one tried anyway, then jump straight to it
+            [[maybe_unused]] auto tried = num_children;
+            if constexpr ((num_children > 0) &&
+                          policy::has_compiled_grammar_v<
+                              boost::mp11::mp_back<std::tuple<DerivedMode, Parents...>>>) {
+                // Only mark the child as tried if it actually was, otherwise the loop below would
+                // skip it
+                const auto first = dispatch_table_type::find_first(front_token);
+                if (first < first_undispatchable_child) {
+                    boost::mp11::mp_with_index<num_children>(first, [&](auto i) {
+                        try_child(i, std::get<i>(this->children()));
+                    });
+                    tried = first;
+                }
+            }
+
+            if (!is_final(match)) {
+                // Children that can only accept the front token by name are looked up rather than
+                // tried in turn
+                const auto candidates = dispatch_table_type::find(front_token);
+                utility::tuple_iterator(
+                    [&]([[maybe_unused]] auto i, const auto& child) {
+                        // The token(s) have been processed (or rejected with an error) so skip
+                        // over any remaining children
+                        if (is_final(match)) {
+                            return;
+                        }
 
-                    // Skip past modes, as they're handled earlier
-                    if constexpr (!traits::is_specialisation_of_v<child_type, mode_t>) {
-                        match = child.pre_parse(
-                            parsing::pre_parse_data{
-                                args,
-                                target,
-                                [&](const auto& real_child, const auto&...) {
-                                    using real_child_type = std::decay_t<decltype(real_child)>;
-                                    return verify_match<real_child_type>(matched[i], front_token);
-                                }},
-                            this_mode,
-                            parents...);
-
-                        // Update the matched bitset
-                        if (match) {
-                            matched.set(i);
+                        if constexpr (dispatch_table_type::template is_dispatchable<i>) {
+                            if (!candidates[i] || (i == tried)) {
+                                return;
+                            }
                         }
-                    }
-                },
-                this->children());
 
-            if (!match) {
+                        try_child(i, child);
+                    },
+                    this->children());
+            }
+
+            if (const auto* e = match.get_error_if()) {
+                return *e;
+            }
+            auto& child_target = *match.get_if();
+            if (!child_target) {
                 if (matched.all()) {
-                    throw multi_lang_exception{error_code::unhandled_arguments, args};
+                    return multi_lang_exception{
+                        error_code::unhandled_arguments,
+                        vector<parsing::token_type>{args.begin(), args.end()}};
                 }
-                parsing::unknown_argument_exception(*this, front_token);
+                return parsing::unknown_argument_error(*this, front_token);
             }
 
             // Flatten out nested sub-targets
-            if (match->sub_targets().empty()) {
-                target.add_sub_target(std::move(*match));
-            } else {
-                for (auto& sub_target : match->sub_targets()) {
-                    target.add_sub_target(std::move(sub_target));
-                }
-            }
+            target.flatten_sub_target(std::move(*child_target));
         }
 
-        return target;
+        return std::optional{std::move(target)};
+    }
+
+    // True if the pre-parse has either matched or returned an error, i.e. there is no need to try
+    // any more nodes
+    [[nodiscard]] static bool is_final(const parsing::pre_parse_target_result& match) noexcept
+    {
+        return match.has_error() || *match.get_if();
     }
 
     template <typename DerivedMode, typename... Parents>
@@ -349,26 +527,12 @@ private:
         auto results = results_type{};
 
         for (auto& sub_target : target.sub_targets()) {
+            const auto index = sub_target.node_index();
             const auto node_hash = sub_target.node_type();
             auto result = sub_target();
 
             if (result.has_value()) {
-                // We need to find the matching node to the sub_target.  We do this by searching
-                // each child's subtree for a match - this gives us the index into the results tuple
-                // and the sub node type for the match
-                auto found = false;
-                utility::tuple_iterator(
-                    [&](auto i, const auto& child) {
-                        if (found) {
-                            return;
-                        }
-
-                        match_child(child, node_hash, [&](const auto& sub_child) {
-                            found = true;
-                            process_result<i>(results, result, sub_child);
-                        });
-                    },
-                    this->children());
+                dispatch_result(results, index, node_hash, std::move(result));
             }
         }
 
@@ -394,15 +558,8 @@ private:
         using routing_policy =
             typename parent_type::template phase_finder_t<policy::has_routing_phase_method>;
         if constexpr (!std::is_void_v<routing_policy>) {
-            // Strip out the skipped results
-            auto stripped_results = algorithm::tuple_filter_and_construct<
-                boost::mp11::mp_not_fn<is_skip_tag>::template fn>(std::move(results));
-
-            std::apply(
-                [&](auto&&... args) {
-                    this->routing_phase(std::forward<std::decay_t<decltype(*args)>>(*args)...);
-                },
-                std::move(stripped_results));
+            // Skip over the skip_tags, and move the results straight into the router
+            route(results, result_indices<results_type>{});
         } else if constexpr (is_anonymous) {
             static_assert(traits::always_false_v<Params...>, "Anonymous modes must have routing");
         } else if constexpr (!boost::mp11::mp_all_of<children_type, is_child_mode>::value) {
@@ -415,46 +572,106 @@ private:
         }
     }
 
-    template <typename Child, typename Handler>
-    static void match_child(const Child& child, std::size_t hash, Handler handler)
+    template <typename ResultsType, typename... Is>
+    void route(ResultsType& results, boost::mp11::mp_list<Is...> /*indices*/) const
     {
-        auto found = false;
-        utility::tree_recursor(
-            [&](const auto& node, const auto&...) {
-                using node_type = std::decay_t<decltype(node)>;
-
-                // Skip modes and nodes without a parse function.  In reality the runtime code will
-                // never allow that, but let's help the compiler out...
-                if constexpr (!traits::is_specialisation_of_v<node_type, mode_t> &&
-                              traits::has_parse_method_v<node_type>) {
-                    if (!found && (utility::type_hash<node_type>() == hash)) {
-                        found = true;
-                        handler(node);
-                    }
-                }
-            },
-            child);
+        using policies_type = typename parent_type::policies_type;
+        constexpr auto bind_index =
+            algorithm::find_specialisation_v<policy::bind_to_t, policies_type>;
+
+        if constexpr (bind_index == std::tuple_size_v<policies_type>) {
+            this->routing_phase(std::move(*std::get<Is::value>(results))...);
+        } else {
+            using bind_type = std::tuple_element_t<bind_index, policies_type>;
+            this->routing_phase(bind_type::bind(std::move(*std::get<Is::value>(results))...));
+        }
+    }
+
+    template <typename ResultsType, std::size_t... Is>
+    [[nodiscard]] constexpr static auto make_result_dispatchers(std::index_sequence<Is...>) noexcept
+    {
+        using dispatcher_type = void (mode_t::*)(ResultsType&, utility::unsafe_any) const;
+        return std::array<dispatcher_type, sizeof...(Is)>{
+            &mode_t::process_indexed_result<Is, ResultsType>...};
+    }
+
+    template <std::size_t... Is>
+    [[nodiscard]] static std::size_t find_parse_entry([[maybe_unused]] std::size_t hash,
+                                                      std::index_sequence<Is...>) noexcept
+    {
+        auto result = parsing::parse_target::no_index;
+        [[maybe_unused]] const auto found =
+            ((utility::type_hash<boost::mp11::mp_at_c<parse_entry_nodes_type, Is>>() == hash &&
+              (result = Is, true)) ||
+             ...);
+        return result;
+    }
+
+    template <typename ResultsType>
+    void dispatch_result(ResultsType& results,
+                         std::size_t index,
+                         std::size_t node_hash,
+                         utility::unsafe_any parse_result) const
+    {
+        using indices_type =
+            std::make_index_sequence<boost::mp11::mp_size<parse_entries_type>::value>;
+
+        // The sub-targets are tagged with their node's index in parse_entries_type, so we can jump
+        // straight to the handler for it rather than searching each child's subtree for a match
+        constexpr auto dispatchers = make_result_dispatchers<ResultsType>(indices_type{});
+
+        // Targets created without this mode in their ancestry are not tagged, so fall back to
+        // searching on the node type
+        if (index == parsing::parse_target::no_index) {
+            index = find_parse_entry(node_hash, indices_type{});
+        }
+
+        if (index < dispatchers.size()) {
+            (this->*dispatchers[index])(results, std::move(parse_result));
+        }
+    }
+
+    template <std::size_t Index, typename ResultsType>
+    void process_indexed_result(ResultsType& results, utility::unsafe_any parse_result) const
+    {
+        using entry_type = boost::mp11::mp_at_c<parse_entries_type, Index>;
+
+        const auto& sub_child = descendant(*this, typename entry_type::path_type{});
+        process_result<entry_type::child_index>(results, std::move(parse_result), sub_child);
+    }
+
+    template <typename Node, std::size_t I, std::size_t... Is>
+    [[nodiscard]] static const auto& descendant(const Node& node,
+                                                std::index_sequence<I, Is...>) noexcept
+    {
+        const auto& child = std::get<I>(node.children());
+        if constexpr (sizeof...(Is) == 0) {
+            return child;
+        } else {
+            return descendant(child, std::index_sequence<Is...>{});
+        }
     }
 
     template <typename Child>
-    [[nodiscard]] static bool verify_match(bool already_matched,
-                                           [[maybe_unused]] parsing::token_type token)
+    [[nodiscard]] static parsing::pre_parse_result verify_match(
+        bool already_matched,
+        [[maybe_unused]] parsing::token_type token)
     {
         if constexpr (!Child::is_named && !policy::has_multi_stage_value_v<Child>) {
             // Child is not named and can only appear on the command line once, so only perform the
             // pre-parse if it hasn't been matched already
-            return !already_matched;
+            return parsing::validation_result(!already_matched);
         } else if constexpr (Child::is_named && !policy::has_multi_stage_value_v<Child>) {
             // Child is named, but can only appear once on the command line, so perform the
             // pre-parse and if there is a match check it isn't already matched
             if (already_matched) {
-                throw multi_lang_exception{error_code::argument_has_already_been_set, token};
+                return multi_lang_exception{error_code::argument_has_already_been_set, token};
             }
 
-            return true;
+            return parsing::pre_parse_action::valid_node;
         } else {
             // Just to prevent C4702 errors on MSVC
-            return true;
+            return parsing::pre_parse_action::valid_node;
         }
     }
 
@@ -494,16 +711,48 @@ private:
                                const ChildType& child,
                                const Parents&... parents) const
     {
-        utility::tuple_type_iterator<typename ChildType::policies_type>([&](auto i) {
-            using policy_type = std::tuple_element_t<i, typename ChildType::policies_type>;
-            if constexpr (policy::has_missing_phase_method_v<policy_type, ValueType>) {
-                result = child.policy_type::template missing_phase<ValueType>(child, parents...);
+        // Values from the environment or a config file take precedence over the missing phase
+        if constexpr (has_fallback_value<ChildType, Parents...>()) {
+            if (const auto value = fallback_value(child, parents...)) {
+                if constexpr (traits::has_maximum_count_method_v<ChildType> &&
+                              (ChildType::maximum_count() == 0)) {
+                    // Flags have no value tokens, so the value is their parsed result.  Use the
+                    // node's own parse phase policy if it has one, as the command line would
+                    using parse_policy = typename ChildType::template phase_finder_t<
+                        policy::has_parse_phase_method,
+                        ValueType>;
+                    if constexpr (std::is_void_v<parse_policy>) {
+                        result = parser<ValueType>::parse(*value);
+                    } else {
+                        result = child.parse_policy::template parse_phase<ValueType>(*value,
+                                                                                    child,
+                                                                                    parents...);
+                    }
+                } else {
+                    // Otherwise parse as though it was the node's only value token, this performs
+                    // the validation too
+                    const auto token = parsing::token_type{parsing::prefix_type::none, *value};
+                    result = child.parse(
+                        parsing::parse_target{parsing::token_buffer{token}, child, parents...},
+                        parents...);
+                    return;
+                }
             }
+        }
+
+        if (!result) {
+            utility::tuple_type_iterator<typename ChildType::policies_type>([&](auto i) {
+                using policy_type = std::tuple_element_t<i, typename ChildType::policies_type>;
+                if constexpr (policy::has_missing_phase_method_v<policy_type, ValueType>) {
+                    result =
+                        child.policy_type::template missing_phase<ValueType>(child, parents...);
+                }
 
 #ifdef _MSC_VER
 #    pragma warning(pop)
 #endif
-        });
+            });
+        }
 
         // If no missing_phase methods were found that made the result valid, then it still needs to
         // be valid - just default initialise
@@ -511,15 +760,88 @@ private:
             result = ValueType{};
         }
 
-        // Irritatingly, we have to run the validation phase on the new value
+        // Irritatingly, we have to run the validation phase on the new value.  Lazy values created
+        // here are already calculated, so validate the underlying value straight away
+        const auto& value = [&]() -> const auto& {
+            if constexpr (traits::is_specialisation_of_v<ValueType, utility::lazy>) {
+                return result->get();
+            } else {
+                return *result;
+            }
+        }();
+        using validated_type = std::decay_t<decltype(value)>;
+
         utility::tuple_type_iterator<typename ChildType::policies_type>([&](auto i) {
             using policy_type = std::tuple_element_t<i, typename ChildType::policies_type>;
-            if constexpr (policy::has_validation_phase_method_v<policy_type, ValueType>) {
-                child.policy_type::template validation_phase(*result, child, parents...);
+            if constexpr (policy::has_validation_phase_method_v<policy_type, validated_type>) {
+                child.policy_type::template validation_phase(value, child, parents...);
             }
         });
     }
 
+    template <typename ChildType>
+    constexpr static auto env_fallback_index =
+        algorithm::find_specialisation_v<policy::env_fallback_t,
+                                         typename ChildType::policies_type>;
+
+    template <typename ChildType>
+    constexpr static bool has_env_fallback =
+        env_fallback_index<ChildType> != std::tuple_size_v<typename ChildType::policies_type>;
+
+    // Config files are only used by named nodes, and only from the root
+    template <typename ChildType, typename... Parents>
+    [[nodiscard]] constexpr static bool has_config_file() noexcept
+    {
+        if constexpr (sizeof...(Parents) > 0) {
+            using root_policies_type =
+                typename boost::mp11::mp_back<std::tuple<Parents...>>::policies_type;
+            return algorithm::has_specialisation_v<policy::config_file, root_policies_type> &&
+                   (traits::has_long_name_method_v<ChildType> ||
+                    traits::has_display_name_method_v<ChildType> ||
+                    traits::has_short_name_method_v<ChildType>);
+        } else {
+            return false;
+        }
+    }
+
+    template <typename ChildType, typename... Parents>
+    [[nodiscard]] constexpr static bool has_fallback_value() noexcept
+    {
+        return has_env_fallback<ChildType> || has_config_file<ChildType, Parents...>();
+    }
+
+    template <typename ChildType, typename... Parents>
+    [[nodiscard]] static std::optional<std::string_view> fallback_value(
+        const ChildType& child,
+        const Parents&... parents)
+    {
+        if (parsing::is_runtime_disabled(child, parents...)) {
+            return {};
+        }
+
+        if constexpr (has_env_fallback<ChildType>) {
+            using env_policy_type = std::tuple_element_t<env_fallback_index<ChildType>,
+                                                         typename ChildType::policies_type>;
+            if (const auto value = env_policy_type::env_value()) {
+                return value;
+            }
+        }
+
+        if constexpr (has_config_file<ChildType, Parents...>()) {
+            using root_policies_type =
+                typename boost::mp11::mp_back<std::tuple<Parents...>>::policies_type;
+            using config_policy_type = std::tuple_element_t<
+                algorithm::find_specialisation_v<policy::config_file, root_policies_type>,
+                root_policies_type>;
+
+            const auto& root = std::get<sizeof...(Parents) - 1>(std::tie(parents...));
+            return static_cast<const config_policy_type&>(root)
+                .template config_value<ChildType>(parents...);
+        } else {
+            return {};
+        }
+    }
+
     template <typename ResultsType, typename... Parents>
     void multi_stage_validation(const ResultsType& results, const Parents&... parents) const
     {
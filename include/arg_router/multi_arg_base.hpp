@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include "arg_router/algorithm.hpp"
+#include "arg_router/policy/lazy_value.hpp"
 #include "arg_router/policy/min_max_count.hpp"
 #include "arg_router/tree_node.hpp"
 
@@ -16,6 +18,9 @@ namespace arg_router
  * policies internally.
  *
  * This is the base class for arg_t, multi_arg_t, and postional_arg_t.
+ *
+ * If policy::lazy_value_t is used, then the value type becomes utility::lazy and the conversion
+ * and validation of the tokens is deferred until the value is first accessed.
  * @note Only supports nodes with a minimum of 1 value token (i.e. is not used for flag-like types)
  * @tparam T Argument value type
  * @tparam MinCount Minimum count value to use if one not specified by user
@@ -47,8 +52,12 @@ class multi_arg_base_t : public add_missing_min_max_policy<MinCount, Policies...
 protected:
     using typename parent_type::policies_type;
 
+    /** True if the conversion is deferred until first access. */
+    constexpr static bool is_lazy =
+        algorithm::has_specialisation_v<policy::lazy_value_t, policies_type>;
+
     /** Argument value type. */
-    using value_type = T;
+    using value_type = std::conditional_t<is_lazy, utility::lazy<T>, T>;
 
     /** Help data type. */
     template <bool Flatten>
@@ -78,7 +87,7 @@ protected:
     }
 
     template <typename Validator, bool HasTarget, typename... Parents>
-    [[nodiscard]] std::optional<parsing::parse_target> pre_parse(
+    [[nodiscard]] parsing::pre_parse_target_result pre_parse(
         parsing::pre_parse_data<Validator, HasTarget> pre_parse_data,
         const Parents&... parents) const
     {
@@ -97,18 +106,68 @@ protected:
     template <typename... Parents>
     [[nodiscard]] value_type parse(parsing::parse_target target, const Parents&... parents) const
     {
-        auto result = value_type{};
-        if constexpr (traits::has_push_back_method_v<value_type> &&
-                      !traits::is_specialisation_of_v<value_type, std::basic_string> &&
+        auto result = [&]() -> value_type {
+            if constexpr (is_lazy) {
+                // The nodes are owned by the root, so they will outlive the parse call
+                static_assert((sizeof...(Parents) + 1) <= config::max_tree_depth,
+                              "Tree depth exceeds config::max_tree_depth");
+                return value_type{&lazy_convert<Parents...>,
+                                  std::move(target.tokens()),
+                                  {{this, std::addressof(parents)...}}};
+            } else {
+                return convert(target.tokens(), parents...);
+            }
+        }();
+
+        // Routing
+        using routing_policy =
+            typename parent_type::template phase_finder_t<policy::has_routing_phase_method>;
+        if constexpr (!std::is_void_v<routing_policy>) {
+            this->routing_policy::routing_phase(std::move(result));
+        }
+
+        return result;
+    }
+
+private:
+    using lazy_ancestry_type = typename utility::lazy<T>::ancestry_type;
+
+    template <typename... Parents>
+    [[nodiscard]] static T lazy_convert(const parsing::token_buffer& tokens,
+                                        const lazy_ancestry_type& ancestry)
+    {
+        return lazy_convert_impl<Parents...>(tokens,
+                                             ancestry,
+                                             std::make_index_sequence<sizeof...(Parents)>{});
+    }
+
+    template <typename... Parents, std::size_t... I>
+    [[nodiscard]] static T lazy_convert_impl(const parsing::token_buffer& tokens,
+                                             const lazy_ancestry_type& ancestry,
+                                             std::index_sequence<I...>)
+    {
+        const auto& node = *static_cast<const multi_arg_base_t*>(ancestry[0]);
+        return node.convert(tokens, *static_cast<const Parents*>(ancestry[I + 1])...);
+    }
+
+    template <typename... Parents>
+    [[nodiscard]] T convert(const parsing::token_buffer& tokens,
+                            const Parents&... parents) const
+    {
+        auto result = T{};
+        if constexpr (traits::has_push_back_method_v<T> &&
+                      !traits::is_specialisation_of_v<T, std::basic_string> &&
                       !std::is_same_v<T, string>) {
-            for (auto token : target.tokens()) {
-                result.push_back(
-                    parent_type::template parse<value_type>(token.name, *this, parents...));
+            // The token count is known up front, so allocate once rather than growing the
+            // container per token
+            if constexpr (traits::has_reserve_method_v<T>) {
+                result.reserve(tokens.size());
             }
-        } else if (!target.tokens().empty()) {
-            result = parent_type::template parse<value_type>(target.tokens().front().name,
-                                                             *this,
-                                                             parents...);
+            for (const auto& token : tokens) {
+                result.push_back(parent_type::template parse<T>(token.name, *this, parents...));
+            }
+        } else if (!tokens.empty()) {
+            result = parent_type::template parse<T>(tokens.front().name, *this, parents...);
         }
 
         // Validation
@@ -116,20 +175,13 @@ protected:
             [&](auto&&... ancestors) {
                 utility::tuple_type_iterator<policies_type>([&](auto i) {
                     using policy_type = std::tuple_element_t<i, policies_type>;
-                    if constexpr (policy::has_validation_phase_method_v<policy_type, value_type>) {
+                    if constexpr (policy::has_validation_phase_method_v<policy_type, T>) {
                         this->policy_type::validation_phase(result, ancestors.get()...);
                     }
                 });
             },
             parsing::clean_node_ancestry_list(*this, parents...));
 
-        // Routing
-        using routing_policy =
-            typename parent_type::template phase_finder_t<policy::has_routing_phase_method>;
-        if constexpr (!std::is_void_v<routing_policy>) {
-            this->routing_policy::routing_phase(std::move(result));
-        }
-
         return result;
     }
 };
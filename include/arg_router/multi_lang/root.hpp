@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include "arg_router/exception.hpp"
 #include "arg_router/multi_lang/translation.hpp"
 #include "arg_router/parsing/token_type.hpp"
+#include "arg_router/utility/result.hpp"
 #include "arg_router/utility/tuple_iterator.hpp"
 
 #include <variant>
@@ -179,6 +181,88 @@ public:
         std::visit([&](const auto& root) { root.parse(argc, argv); }, *root_);
     }
 
+    /** Calls the try_parse method on the selected root.
+     *
+     * The first element is @em not expected to be the executable name.
+     * @param args Vector of tokens
+     * @return Empty result, or the parse error
+     */
+    [[nodiscard]] utility::result<void, parse_exception> try_parse(
+        vector<parsing::token_type> args) const
+    {
+        return std::visit([&](const auto& root) { return root.try_parse(std::move(args)); },
+                          *root_);
+    }
+
+    /** Calls the try_parse method on the selected root.
+     *
+     * The first element is @em not expected to be the executable name.
+     * @note The strings must out live the parse process as they are not copied.
+     * @tparam Iter Iterator type to <TT>std::string_view</TT> convertible elements
+     * @param begin Iterator to the first element
+     * @param end Iterator to the one-past-the-end element
+     * @return Empty result, or the parse error
+     */
+    template <typename Iter, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Iter>, int>>>
+    [[nodiscard]] utility::result<void, parse_exception> try_parse(Iter begin, Iter end) const
+    {
+        return std::visit([&](const auto& root) { return root.try_parse(begin, end); }, *root_);
+    }
+
+    /** Calls the try_parse method on the selected root.
+     *
+     * The first element is @em not expected to be the executable name.
+     * @note This does not take part in overload resolution if @a c is a
+     * <TT>vector\<parsing::token_type\></TT>
+     * @tparam Container
+     * @param c Elements to parse
+     * @return Empty result, or the parse error
+     */
+    template <typename Container,
+              typename = std::enable_if_t<
+                  !std::is_same_v<std::decay_t<Container>, vector<parsing::token_type>>>>
+    [[nodiscard]] utility::result<void, parse_exception> try_parse(const Container& c) const
+    {
+        return std::visit([&](const auto& root) { return root.try_parse(c); }, *root_);
+    }
+
+    /** Calls the try_parse method on the selected root.
+     *
+     * @param argc Number of arguments
+     * @param argv Array of char pointers to the command line tokens
+     * @return Empty result, or the parse error
+     */
+    [[nodiscard]] utility::result<void, parse_exception> try_parse(int argc, char** argv) const
+    {
+        return std::visit([&](const auto& root) { return root.try_parse(argc, argv); }, *root_);
+    }
+
+    /** Calls the parse_command_line method on the selected root.
+     *
+     * @note Tokens without quotes or escapes are not copied, so @a command_line must out live the
+     * parse process
+     * @param command_line Command string
+     */
+    void parse_command_line(std::string_view command_line) const
+    {
+        std::visit([&](const auto& root) { root.parse_command_line(command_line); }, *root_);
+    }
+
+    /** Calls the try_parse_command_line method on the selected root.
+     *
+     * @note Tokens without quotes or escapes are not copied, so @a command_line must out live the
+     * parse process
+     * @param command_line Command string
+     * @return Empty result, or the parse error
+     */
+    [[nodiscard]] utility::result<void, parse_exception> try_parse_command_line(
+        std::string_view command_line) const
+    {
+        return std::visit(
+            [&](const auto& root) { return root.try_parse_command_line(command_line); },
+            *root_);
+    }
+
     /** Calls the help method on the selected root.
      *
      * @param stream Output stream to write into
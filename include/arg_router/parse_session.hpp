@@ -0,0 +1,162 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "arg_router/parsing/token_list.hpp"
+#include "arg_router/utility/result.hpp"
+
+#include <cstdint>
+#include <deque>
+#include <optional>
+
+namespace arg_router
+{
+/** Pre-parse status of the tokens received by a parse_session so far. */
+enum class parse_session_status : std::uint8_t {
+    complete,   ///< All the tokens have been matched to nodes
+    incomplete  ///< A node is waiting for more value tokens
+};
+
+/** Accumulates tokens as they arrive and parses them once complete.
+ *
+ * This is intended for interactive front-ends (e.g. a REPL) where tokens arrive one at a time or
+ * in chunks.  check() runs just the pre-parse phase over the tokens received so far, which matches
+ * tokens to nodes without converting values, validating, or routing; so unknown or repeated
+ * arguments can be reported whilst the user is still typing.  The expensive parse, validation, and
+ * routing is deferred until finish().
+ * @code
+ * auto session = ar::parse_session{r};
+ * session.push_back("--foo");
+ * if (const auto status = session.check(); !status) {
+ *     std::cerr << status.get_error_if()->what() << std::endl;
+ * } else if (*status.get_if() == ar::parse_session_status::incomplete) {
+ *     // --foo is waiting for its value
+ * }
+ * ...
+ * session.finish().throw_exception();
+ * @endcode
+ * @note check() is not incremental, the pre-parse is re-run from the first token on each call as
+ * variable length nodes cannot know they are complete until all the tokens have arrived.  So the
+ * cost of each call is linear in the number of tokens received, the result is cached until the
+ * tokens are next updated
+ * @tparam Root Root type
+ */
+template <typename Root>
+class parse_session
+{
+public:
+    /** Root type. */
+    using root_type = Root;
+    /** Status type. */
+    using status = parse_session_status;
+
+    /** Constructor.
+     *
+     * @param root Root to parse with, must outlive this session
+     */
+    explicit parse_session(const root_type& root) noexcept : root_{&root} {}
+
+    // The tokens refer to the strings owned by this instance, so copying is not allowed
+    parse_session(const parse_session&) = delete;
+    parse_session& operator=(const parse_session&) = delete;
+    parse_session(parse_session&&) = default;
+    parse_session& operator=(parse_session&&) = default;
+
+    /** Appends a copy of @a token to the session.
+     *
+     * @param token Token to append
+     */
+    void push_back(std::string_view token)
+    {
+        // std::deque does not invalidate references to its elements when appending, so the tokens
+        // can refer to the strings directly
+        const auto& str = strings_.emplace_back(token);
+        tokens_.push_back(parsing::classify(str));
+        status_.reset();
+    }
+
+    /** Appends a copy of the <TT>std::string_view</TT> convertible elements between @a begin and
+     * @a end.
+     *
+     * @tparam Iter Iterator type to <TT>std::string_view</TT> convertible elements
+     * @param begin Iterator to the first element
+     * @param end Iterator to the one-past-the-end element
+     */
+    template <typename Iter>
+    void append(Iter begin, Iter end)
+    {
+        for (; begin != end; ++begin) {
+            push_back(*begin);
+        }
+    }
+
+    /** Returns the number of tokens received so far.
+     *
+     * @return Token count
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return tokens_.size(); }
+
+    /** @return True if no tokens have been received.
+     */
+    [[nodiscard]] bool empty() const noexcept { return tokens_.empty(); }
+
+    /** Pre-parses the tokens received so far.
+     *
+     * Errors that can only be detected once all the tokens have been received (e.g. missing
+     * required arguments or values that fail to convert) are not reported.  A node that has not
+     * yet received its minimum number of value tokens (e.g. <TT>--foo</TT> without its value)
+     * is reported as parse_session_status::incomplete rather than an error.
+     * @note A node with a token end marker that has too few value tokens before the marker is also
+     * reported as parse_session_status::incomplete, finish() will report the error
+     * @return The status if the tokens so far are acceptable, otherwise the parse_exception
+     * describing the error
+     */
+    [[nodiscard]] const utility::result<status, parse_exception>& check()
+    {
+        if (!status_) {
+            // Pre-parsing consumes the tokens, so it needs to work on a copy.  Assigning into the
+            // scratch list reuses its storage between calls
+            scratch_ = tokens_;
+
+            auto result = root_->try_pre_parse_impl(scratch_);
+            if (const auto* complete = result.get_if()) {
+                status_ = *complete ? status::complete : status::incomplete;
+            } else {
+                status_ = std::move(*result.get_error_if());
+            }
+        }
+
+        return *status_;
+    }
+
+    /** Parses and routes all of the received tokens, then clears the session ready for reuse.
+     *
+     * @return Empty result on success, otherwise the parse_exception describing the error
+     */
+    [[nodiscard]] utility::result<void, parse_exception> finish()
+    {
+        auto result = root_->try_parse_impl(tokens_);
+        clear();
+
+        return result;
+    }
+
+    /** Removes all the received tokens. */
+    void clear() noexcept
+    {
+        tokens_.clear();
+        scratch_.clear();
+        strings_.clear();
+        status_.reset();
+    }
+
+private:
+    const root_type* root_;
+    std::deque<string, config::allocator<string>> strings_;
+    parsing::token_list tokens_;
+    parsing::token_list scratch_;
+    std::optional<utility::result<status, parse_exception>> status_;
+};
+}  // namespace arg_router
@@ -0,0 +1,255 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "arg_router/exception.hpp"
+
+#include <algorithm>
+#include <optional>
+
+namespace arg_router::parsing
+{
+/** A sorted key/value table indexed from the contents of an INI/TOML-like configuration file.
+ *
+ * The format is the same subset of TOML used by the translation generator resources:
+ * @code
+ * # Comment
+ * threads = 4
+ * name = "Hello \"world\""  # Trailing comment
+ *
+ * [copy]
+ * force = true
+ * @endcode
+ * Keys before the first section header have an empty section.  Values can be bare (ending at the
+ * first <TT>#</TT>), single-quoted literals, or double-quoted strings supporting the
+ * <TT>\\"</TT>, <TT>\\\\</TT>, <TT>\\n</TT>, <TT>\\r</TT>, and <TT>\\t</TT> escapes.  If a key is
+ * repeated within a section, the last value wins.
+ *
+ * The entries view the indexed buffer, so it must outlive the table.
+ */
+class config_table
+{
+public:
+    /** Table entry. */
+    struct entry {
+        std::string_view section;  ///< Section name, empty for the top-level
+        std::string_view key;      ///< Key
+        std::string_view value;    ///< Unquoted and unescaped value
+    };
+
+    /** Allocator type. */
+    using allocator_type = vector<entry>::allocator_type;
+
+    /** Constructor.
+     *
+     * @param alloc Allocator for the entries
+     */
+    explicit config_table(const allocator_type& alloc = allocator_type{}) : entries_(alloc) {}
+
+    /** Indexes @a buffer in a single pass.
+     *
+     * Double-quoted values are unescaped in place, so @a buffer is modified.
+     * @param buffer Configuration file contents
+     * @param alloc Allocator for the entries
+     * @return Table
+     * @exception multi_lang_exception Thrown if a line cannot be parsed
+     */
+    [[nodiscard]] static config_table index(span<char> buffer,
+                                            const allocator_type& alloc = allocator_type{})
+    {
+        auto table = config_table{alloc};
+        auto section = std::string_view{};
+
+        auto* first = buffer.data();
+        auto* const last = first + buffer.size();
+        while (first != last) {
+            auto* line_last = std::find(first, last, '\n');
+            auto line = trim(first, line_last);
+            first = (line_last == last) ? last : line_last + 1;
+
+            if ((line.first == line.second) || (*line.first == '#')) {
+                continue;
+            }
+
+            const auto line_view = std::string_view{line.first, size(line)};
+            if (*line.first == '[') {
+                section = parse_section(line, line_view);
+                continue;
+            }
+
+            auto* separator = std::find(line.first, line.second, '=');
+            const auto key = trim(line.first, separator);
+            if ((separator == line.second) || (key.first == key.second)) {
+                throw_invalid_line(line_view);
+            }
+
+            table.entries_.push_back(
+                entry{section,
+                      std::string_view{key.first, size(key)},
+                      parse_value(trim(separator + 1, line.second), line_view)});
+        }
+
+        // The entries view the buffer in file order, so ordering repeated keys by address puts the
+        // last definition at the end of its equal range.  This avoids the temporary buffer
+        // std::stable_sort allocates outside of the table's allocator
+        std::sort(table.entries_.begin(),
+                  table.entries_.end(),
+                  [](const entry& a, const entry& b) {
+                      return less(a, b) || (!less(b, a) && (a.key.data() < b.key.data()));
+                  });
+        return table;
+    }
+
+    /** Returns the value of @a key in @a section.
+     *
+     * @param section Section name, empty for the top-level
+     * @param key Key
+     * @return Value, or an empty optional if not present
+     */
+    [[nodiscard]] std::optional<std::string_view> find(std::string_view section,
+                                                       std::string_view key) const noexcept
+    {
+        const auto needle = entry{section, key, {}};
+        const auto it = std::upper_bound(entries_.begin(), entries_.end(), needle, less);
+        if ((it == entries_.begin()) || less(*std::prev(it), needle)) {
+            return {};
+        }
+        return std::prev(it)->value;
+    }
+
+    /** Returns the entries sorted by section and then key.
+     *
+     * @return Entries
+     */
+    [[nodiscard]] const vector<entry>& entries() const noexcept { return entries_; }
+
+    /** Returns the allocator used for the entries.
+     *
+     * @return Allocator
+     */
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+        return entries_.get_allocator();
+    }
+
+private:
+    using range = std::pair<char*, char*>;
+
+    [[nodiscard]] static std::size_t size(range r) noexcept
+    {
+        return static_cast<std::size_t>(r.second - r.first);
+    }
+
+    [[nodiscard]] static bool less(const entry& a, const entry& b) noexcept
+    {
+        return (a.section < b.section) || ((a.section == b.section) && (a.key < b.key));
+    }
+
+    [[nodiscard]] static bool is_whitespace(char c) noexcept
+    {
+        return (c == ' ') || (c == '\t') || (c == '\r');
+    }
+
+    [[nodiscard]] static range trim(char* first, char* last) noexcept
+    {
+        while ((first != last) && is_whitespace(*first)) {
+            ++first;
+        }
+        while ((first != last) && is_whitespace(*(last - 1))) {
+            --last;
+        }
+        return {first, last};
+    }
+
+    // Everything after a value must be whitespace or a comment
+    [[nodiscard]] static bool is_trailing_comment(char* first, char* last) noexcept
+    {
+        const auto r = trim(first, last);
+        return (r.first == r.second) || (*r.first == '#');
+    }
+
+    [[noreturn]] static void throw_invalid_line(std::string_view line)
+    {
+        throw multi_lang_exception{error_code::invalid_config_line,
+                                   token_type{prefix_type::none, line}};
+    }
+
+    [[nodiscard]] static std::string_view parse_section(range line, std::string_view line_view)
+    {
+        auto* close = std::find(line.first, line.second, ']');
+        const auto name = trim(line.first + 1, close);
+        if ((close == line.second) || (name.first == name.second) ||
+            !is_trailing_comment(close + 1, line.second)) {
+            throw_invalid_line(line_view);
+        }
+        return {name.first, size(name)};
+    }
+
+    [[nodiscard]] static std::string_view parse_value(range value, std::string_view line_view)
+    {
+        if (value.first == value.second) {
+            throw_invalid_line(line_view);
+        }
+
+        if (*value.first == '\'') {
+            auto* close = std::find(value.first + 1, value.second, '\'');
+            if ((close == value.second) || !is_trailing_comment(close + 1, value.second)) {
+                throw_invalid_line(line_view);
+            }
+            return {value.first + 1, static_cast<std::size_t>(close - value.first - 1)};
+        }
+
+        if (*value.first == '"') {
+            return parse_basic_string(value, line_view);
+        }
+
+        value = trim(value.first, std::find(value.first, value.second, '#'));
+        if (value.first == value.second) {
+            throw_invalid_line(line_view);
+        }
+        return {value.first, size(value)};
+    }
+
+    [[nodiscard]] static std::string_view parse_basic_string(range value,
+                                                             std::string_view line_view)
+    {
+        const auto escaped = [](char c) -> std::optional<char> {
+            switch (c) {
+            case '"': return '"';
+            case '\\': return '\\';
+            case 'n': return '\n';
+            case 'r': return '\r';
+            case 't': return '\t';
+            default: return {};
+            }
+        };
+
+        // Validate before modifying anything, so the line is intact for the error message
+        auto* close = value.first + 1;
+        for (; (close != value.second) && (*close != '"'); ++close) {
+            if (*close == '\\') {
+                if ((++close == value.second) || !escaped(*close)) {
+                    throw_invalid_line(line_view);
+                }
+            }
+        }
+        if ((close == value.second) || !is_trailing_comment(close + 1, value.second)) {
+            throw_invalid_line(line_view);
+        }
+
+        auto* out = value.first + 1;
+        for (auto* it = out; it != close; ++it, ++out) {
+            if (*it == '\\') {
+                *out = *escaped(*(++it));
+            } else if (out != it) {
+                *out = *it;
+            }
+        }
+        return {value.first + 1, static_cast<std::size_t>(out - value.first - 1)};
+    }
+
+    vector<entry> entries_;
+};
+}  // namespace arg_router::parsing
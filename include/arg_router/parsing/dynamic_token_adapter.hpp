@@ -4,7 +4,7 @@
 
 #pragma once
 
-#include "arg_router/parsing/token_type.hpp"
+#include "arg_router/parsing/token_list.hpp"
 
 namespace arg_router::parsing
 {
@@ -18,6 +18,12 @@ namespace arg_router::parsing
  *
  * This allows the pre-parse phase implementing policies to not concern themselves with managing the
  * processed/unprocessed containers.
+ *
+ * The unprocessed container is treated as a checkpoint: it is not modified until commit() is
+ * called.  Tokens transferred out of it just advance a head offset, and any tokens added to the
+ * front of the unprocessed side are held by the adapter.  This means that a node that rejects the
+ * tokens can just discard the adapter, rather than having to work on a copy of the unprocessed
+ * tokens.
  */
 class dynamic_token_adapter
 {
@@ -211,7 +217,7 @@ public:
         {
             if (i_ >= static_cast<difference_type>(processed().size())) {
                 const auto i = i_ - processed().size();
-                return unprocessed()[i];
+                return owner_->unprocessed_at(i);
             }
 
             return processed()[i_];
@@ -295,9 +301,7 @@ public:
             return !owner_ || (i_ >= static_cast<difference_type>(owner_->size()));
         }
 
-        [[nodiscard]] vector<token_type>& processed() const { return *(owner_->processed_); }
-
-        [[nodiscard]] vector<token_type>& unprocessed() const { return *(owner_->unprocessed_); }
+        [[nodiscard]] token_buffer& processed() const { return *(owner_->processed_); }
 
         dynamic_token_adapter* owner_;
         difference_type i_;
@@ -306,15 +310,11 @@ public:
     /** Constructor.
      *
      * @param processed Processed tokens container
-     * @param unprocessed Unprocessed tokens container
+     * @param unprocessed Unprocessed tokens container, not modified until commit() is called
      */
-    dynamic_token_adapter(vector<token_type>& processed, vector<token_type>& unprocessed) :
-        processed_{&processed}, unprocessed_{&unprocessed}
+    dynamic_token_adapter(token_buffer& processed, token_list& unprocessed) noexcept :
+        processed_{&processed}, unprocessed_{&unprocessed}, head_{0}
     {
-        // Perform a reserve for all the tokens.  There is a resonable chance that more processed
-        // than unprocessed tokens will be needed (due to short-form expansion, value separation,
-        // etc.), but this should still dramatically reduce the number of allocations needed
-        unprocessed_->reserve(size());
     }
 
     /** Equality operator.
@@ -324,7 +324,7 @@ public:
      * @param other Instance to compare against
      * @return True if equal
      */
-    [[nodiscard]] bool operator==(dynamic_token_adapter other) const
+    [[nodiscard]] bool operator==(const dynamic_token_adapter& other) const noexcept
     {
         return (processed_ == other.processed_) && (unprocessed_ == other.unprocessed_);
     }
@@ -336,7 +336,10 @@ public:
      * @param other Instance to compare against
      * @return True if not equal
      */
-    [[nodiscard]] bool operator!=(dynamic_token_adapter other) const { return !(*this == other); }
+    [[nodiscard]] bool operator!=(const dynamic_token_adapter& other) const noexcept
+    {
+        return !(*this == other);
+    }
 
     /** Returns an iterator to the beginning of the processed container.
      *
@@ -357,23 +360,31 @@ public:
      *
      * @return Number of components
      */
-    [[nodiscard]] size_type size() const { return processed_->size() + unprocessed_->size(); }
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return processed_->size() + unprocessed_size();
+    }
 
     /** @return True if there are no processed or unprocessed tokens.
      */
-    [[nodiscard]] bool empty() const { return processed_->empty() && unprocessed_->empty(); }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
 
     /** The underlying processed container.
      *
      * @return Processed container reference
      */
-    [[nodiscard]] vector<value_type>& processed() { return *processed_; }
+    [[nodiscard]] token_buffer& processed() noexcept { return *processed_; }
 
-    /** The underlying unprocessed container.
+    /** Returns the number of tokens on the unprocessed side.
      *
-     * @return Unprocessed container reference
+     * This includes tokens added by insert_unprocessed(size_type, value_type) that have not yet
+     * been committed.
+     * @return Unprocessed token count
      */
-    [[nodiscard]] vector<value_type>& unprocessed() { return *unprocessed_; }
+    [[nodiscard]] size_type unprocessed_size() const noexcept
+    {
+        return front_.size() + (unprocessed_->size() - head_);
+    }
 
     /** Inserts @a token at position @a it.
      *
@@ -414,6 +425,36 @@ public:
         return {this, it.i_};
     }
 
+    /** Inserts @a value into the unprocessed side at @a pos.
+     *
+     * The value is held by the adapter until commit() is called.
+     * @param pos Position relative to the start of the unprocessed tokens, must not be greater than
+     * unprocessed_size()
+     * @param value Value to insert
+     */
+    void insert_unprocessed(size_type pos, value_type value)
+    {
+        // The front buffer must cover the insertion point
+        materialise(pos);
+        front_.insert(front_.begin() + pos, value);
+    }
+
+    /** Inserts the values in the range [ @a first, @a last ) into the unprocessed side at @a pos.
+     *
+     * The values are held by the adapter until commit() is called.
+     * @tparam Iter Forward iterator type
+     * @param pos Position relative to the start of the unprocessed tokens, must not be greater than
+     * unprocessed_size()
+     * @param first Iterator to first instance in range to insert
+     * @param last One-past-the-end iterator of range to insert
+     */
+    template <typename Iter>
+    void insert_unprocessed(size_type pos, Iter first, Iter last)
+    {
+        materialise(pos);
+        front_.insert(front_.begin() + pos, first, last);
+    }
+
     /** Erases the element at @a it.
      *
      * Does not perform any transfer between the process and unprocessed sides.
@@ -431,8 +472,14 @@ public:
         if (it.i_ < processed_size) {
             processed_->erase(processed_->begin() + it.i_);
         } else {
-            const auto offset = it.i_ - processed_size;
-            unprocessed_->erase(unprocessed_->begin() + offset);
+            const auto offset = static_cast<size_type>(it.i_ - processed_size);
+            materialise(offset);
+            if (offset < front_.size()) {
+                front_.erase(front_.begin() + offset);
+            } else {
+                // Erasing the head of the unprocessed container is just a case of skipping past it
+                ++head_;
+            }
         }
 
         return it;
@@ -455,13 +502,63 @@ public:
             return;
         }
 
-        const auto count = (it.i_ + 1) - processed_->size();
-        processed_->insert(processed_->end(), unprocessed_->begin(), unprocessed_->begin() + count);
-        unprocessed_->erase(unprocessed_->begin(), unprocessed_->begin() + count);
+        auto count = static_cast<size_type>((it.i_ + 1) - processed_->size());
+
+        // Take from the adapter-held tokens first, as they sit in front of the unprocessed tokens
+        const auto front_count = std::min(count, front_.size());
+        processed_->insert(processed_->end(), front_.begin(), front_.begin() + front_count);
+        front_.erase(front_.begin(), front_.begin() + front_count);
+        count -= front_count;
+
+        processed_->insert(processed_->end(),
+                           unprocessed_->begin() + head_,
+                           unprocessed_->begin() + head_ + count);
+        head_ += count;
+    }
+
+    /** Applies the changes made to the unprocessed side to the underlying unprocessed container.
+     *
+     * Until this is called, the unprocessed container passed to the constructor is unchanged.
+     */
+    void commit()
+    {
+        // Both of these are cheap as they operate on the front of the list, and the insertion
+        // re-uses the slots of the consumed tokens where possible
+        auto& unprocessed = *unprocessed_;
+        unprocessed.erase(unprocessed.begin(), unprocessed.begin() + head_);
+        unprocessed.insert(unprocessed.begin(), front_.begin(), front_.end());
+
+        front_.clear();
+        head_ = 0;
     }
 
 private:
-    vector<token_type>* processed_;
-    vector<token_type>* unprocessed_;
+    [[nodiscard]] const value_type& unprocessed_at(size_type i) const noexcept
+    {
+        if (i < front_.size()) {
+            return front_[i];
+        }
+        return (*unprocessed_)[head_ + (i - front_.size())];
+    }
+
+    // Ensures that the adapter-held front buffer covers the unprocessed tokens up to (but not
+    // including) @a count, so they can be modified without touching the unprocessed container
+    void materialise(size_type count)
+    {
+        if (count <= front_.size()) {
+            return;
+        }
+
+        const auto extra = count - front_.size();
+        front_.insert(front_.end(),
+                      unprocessed_->begin() + head_,
+                      unprocessed_->begin() + head_ + extra);
+        head_ += extra;
+    }
+
+    token_buffer* processed_;
+    token_list* unprocessed_;
+    token_buffer front_;
+    size_type head_;
 };
 }  // namespace arg_router::parsing
@@ -10,8 +10,52 @@
 
 #include <boost/lexical_cast/try_lexical_convert.hpp>
 
+#include <charconv>
+
 namespace arg_router
 {
+namespace detail
+{
+// Character types are parsed as a single character by boost::lexical_cast, rather than as an
+// integer, so they stay on that path
+template <typename T>
+constexpr bool is_character_type_v =
+    std::is_same_v<T, char> || std::is_same_v<T, signed char> ||
+    std::is_same_v<T, unsigned char> || std::is_same_v<T, wchar_t> ||
+    std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t>
+#ifdef __cpp_char8_t
+    || std::is_same_v<T, char8_t>
+#endif
+    ;
+
+// Floating point std::from_chars support is patchy, so fall back to boost::lexical_cast if the
+// standard library does not have it
+template <typename T>
+constexpr bool use_from_chars_v = (std::is_integral_v<T> && !is_character_type_v<T>)
+#ifdef __cpp_lib_to_chars
+                                  || std::is_floating_point_v<T>
+#endif
+    ;
+
+template <typename T>
+[[nodiscard]] bool from_chars(std::string_view token, T& result) noexcept
+{
+    // std::from_chars does not accept a leading plus sign, so strip it - but only one
+    if (!token.empty() && (token.front() == '+')) {
+        token.remove_prefix(1);
+        if (!token.empty() && ((token.front() == '+') || (token.front() == '-'))) {
+            return false;
+        }
+    }
+
+    const auto* last = token.data() + token.size();
+    const auto [ptr, ec] = std::from_chars(token.data(), last, result);
+
+    // The whole token must be consumed
+    return (ec == std::errc{}) && (ptr == last);
+}
+}  // namespace detail
+
 /** Global parsing struct.
  *
  * If you want to provide custom parsing for an entire @em type, then you should specialise this.
@@ -40,7 +84,14 @@ struct parser<T, typename std::enable_if_t<std::is_arithmetic_v<T>>> {
         using namespace std::string_view_literals;
 
         auto result = T{};
-        if (!boost::conversion::try_lexical_convert(token, result)) {
+        const auto success = [&]() {
+            if constexpr (detail::use_from_chars_v<T>) {
+                return detail::from_chars(token, result);
+            } else {
+                return boost::conversion::try_lexical_convert(token, result);
+            }
+        }();
+        if (!success) {
             throw multi_lang_exception{error_code::failed_to_parse,
                                        parsing::token_type{parsing::prefix_type::none, token}};
         }
@@ -0,0 +1,205 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "arg_router/parsing/token_type.hpp"
+#include "arg_router/policy/policy.hpp"
+#include "arg_router/traits.hpp"
+#include "arg_router/utility/utf8.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+
+namespace arg_router::parsing
+{
+namespace detail
+{
+struct name_dispatch_entry {
+    prefix_type prefix;
+    std::string_view name;
+    std::size_t index;
+};
+
+[[nodiscard]] constexpr bool name_dispatch_less(const name_dispatch_entry& lhs,
+                                                const name_dispatch_entry& rhs) noexcept
+{
+    if (lhs.prefix != rhs.prefix) {
+        return lhs.prefix < rhs.prefix;
+    }
+    return lhs.name < rhs.name;
+}
+
+template <typename Child>
+struct is_name_dispatchable {
+    template <typename Policy>
+    using fn = boost::mp11::mp_bool<!policy::has_pre_parse_phase_method_v<Policy> ||
+                                    policy::supports_name_dispatch_v<Policy>>;
+
+    constexpr static bool value =
+        Child::is_named && boost::mp11::mp_all_of<typename Child::policies_type, fn>::value;
+};
+
+template <typename Child>
+[[nodiscard]] constexpr std::size_t name_dispatch_count() noexcept
+{
+    if constexpr (is_name_dispatchable<Child>::value) {
+        return (traits::has_long_name_method_v<Child> ? 1 : 0) +
+               (traits::has_short_name_method_v<Child> ? 1 : 0) +
+               (traits::has_none_name_method_v<Child> ? 1 : 0);
+    } else {
+        return 0;
+    }
+}
+
+template <std::size_t I, typename Child, typename Entries>
+constexpr void add_name_dispatch_entries(Entries& entries, std::size_t& pos) noexcept
+{
+    if constexpr (is_name_dispatchable<Child>::value) {
+        if constexpr (traits::has_long_name_method_v<Child>) {
+            entries[pos++] = name_dispatch_entry{prefix_type::long_, Child::long_name(), I};
+        }
+        if constexpr (traits::has_short_name_method_v<Child>) {
+            entries[pos++] = name_dispatch_entry{prefix_type::short_, Child::short_name(), I};
+        }
+        if constexpr (traits::has_none_name_method_v<Child>) {
+            entries[pos++] = name_dispatch_entry{prefix_type::none, Child::none_name(), I};
+        }
+    }
+}
+
+template <typename... Children, std::size_t... I>
+[[nodiscard]] constexpr auto build_name_dispatch_entries(
+    std::index_sequence<I...> /*indices*/) noexcept
+{
+    auto entries =
+        std::array<name_dispatch_entry, (name_dispatch_count<Children>() + ... + 0)>{};
+    [[maybe_unused]] auto pos = std::size_t{0};
+    (add_name_dispatch_entries<I, Children>(entries, pos), ...);
+
+    // Insertion sort, as the std algorithms are not constexpr in C++17
+    for (auto i = std::size_t{1}; i < entries.size(); ++i) {
+        const auto value = entries[i];
+        auto j = i;
+        for (; (j > 0) && name_dispatch_less(value, entries[j - 1]); --j) {
+            entries[j] = entries[j - 1];
+        }
+        entries[j] = value;
+    }
+
+    return entries;
+}
+
+template <typename Children>
+struct name_dispatch_entries;
+
+template <typename... Children>
+struct name_dispatch_entries<std::tuple<Children...>> {
+    constexpr static auto value =
+        build_name_dispatch_entries<Children...>(std::index_sequence_for<Children...>{});
+};
+}  // namespace detail
+
+/** Compile-time lookup table that maps a token to the children of a node that could accept it.
+ *
+ * Named children whose pre-parse phase policies all support name dispatch (see
+ * policy::supports_name_dispatch) can only accept a token that matches one of their names, so their
+ * long, short, and none names are collected into a sorted array at compile-time.  A token can then
+ * be resolved to the indices of the children that may own it with a binary search, rather than
+ * running the full pre-parse of every child.
+ *
+ * Any other child (unnamed, or with a policy that can rewrite the label token e.g.
+ * policy::value_separator_t) is not dispatchable and must still be tried in turn.
+ * @tparam Children Tuple of child node types
+ */
+template <typename Children>
+class name_dispatch_table
+{
+public:
+    /** Number of children in the table. */
+    constexpr static auto num_children = std::tuple_size_v<Children>;
+
+    /** Return type of find(token_type), a set bit represents a candidate child index. */
+    using candidates_type = std::bitset<num_children>;
+
+    /** Evaluates to true if the child at index @a I can be found via find(token_type).
+     *
+     * If false, the child should be tried regardless of the result of find(token_type).
+     * @tparam I Child index
+     */
+    template <std::size_t I>
+    constexpr static bool is_dispatchable =
+        detail::is_name_dispatchable<std::tuple_element_t<I, Children>>::value;
+
+    /** Returns the indices of the dispatchable children that may accept @a token as their label.
+     *
+     * If @a token has not been processed yet (i.e. it has no prefix), then it is checked as a
+     * none name and as its prefixed form - mirroring how a child would convert it during its own
+     * pre-parse.  Short form tokens are also checked using just their first character, to find
+     * children that would expand them.  The result may be a superset of the children that will
+     * actually accept the token, but it will never miss one.
+     * @param token Token to look up
+     * @return Candidate children
+     */
+    [[nodiscard]] static candidates_type find(token_type token) noexcept
+    {
+        auto candidates = candidates_type{};
+        lookup_all(token, [&](std::size_t index) { candidates.set(index); });
+
+        return candidates;
+    }
+
+    /** Returns the lowest index of the dispatchable children that may accept @a token as their
+     * label.
+     *
+     * This is equivalent to the first set bit in the result of find(token_type), without having
+     * to scan the bitset for it.
+     * @param token Token to look up
+     * @return Lowest candidate child index, or num_children if there are no candidates
+     */
+    [[nodiscard]] static std::size_t find_first(token_type token) noexcept
+    {
+        auto first = num_children;
+        lookup_all(token, [&](std::size_t index) { first = std::min(first, index); });
+
+        return first;
+    }
+
+private:
+    template <typename Fn>
+    static void lookup_all(token_type token, const Fn& fn) noexcept
+    {
+        lookup(token, fn);
+
+        if (token.prefix == prefix_type::none) {
+            token = get_token_type(token);
+            if (token.prefix == prefix_type::none) {
+                return;
+            }
+            lookup(token, fn);
+        }
+
+        if ((token.prefix == prefix_type::short_) && !token.name.empty()) {
+            lookup({prefix_type::short_, *utility::utf8::iterator{token.name}}, fn);
+        }
+    }
+
+    template <typename Fn>
+    static void lookup(token_type token, const Fn& fn) noexcept
+    {
+        constexpr auto& entries = detail::name_dispatch_entries<Children>::value;
+
+        const auto key = detail::name_dispatch_entry{token.prefix, token.name, 0};
+        for (auto it = std::lower_bound(entries.begin(),
+                                        entries.end(),
+                                        key,
+                                        detail::name_dispatch_less);
+             (it != entries.end()) && !detail::name_dispatch_less(key, *it);
+             ++it) {
+            fn(it->index);
+        }
+    }
+};
+}  // namespace arg_router::parsing
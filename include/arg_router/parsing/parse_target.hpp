@@ -11,7 +11,10 @@
 
 #include <boost/mp11/algorithm.hpp>
 
-#include <functional>
+#include <array>
+#include <iterator>
+#include <limits>
+#include <utility>
 
 namespace arg_router
 {
@@ -24,10 +27,22 @@ namespace parsing
  * parse of other nodes e.g. mode-like types.
  *
  * The target can only be invoked once, invoking a second or more time is a no-op.
+ *
+ * The target node and its parents are stored as an inline array of type-erased pointers alongside
+ * a function pointer that restores their types, so creating a target does not allocate (other
+ * than for any tokens).  The maximum number of nodes is set by config::max_tree_depth, a deeper
+ * tree fails to compile.
+ *
+ * If one of the target node's parents defines a <TT>node_index</TT> static variable template (e.g.
+ * mode_t), then the nearest one is used to get a dense compile-time index for the target node, see
+ * node_index().
  */
 class parse_target
 {
 public:
+    /** Value returned by node_index() when no parent indexes the target node. */
+    constexpr static auto no_index = std::numeric_limits<std::size_t>::max();
+
     /** Constructor.
      *
      * @tparam Node Target node type
@@ -38,19 +53,16 @@ public:
      * @param parents Parents of @a node
      */
     template <typename Node, typename... Parents>
-    parse_target(vector<token_type> tokens, const Node& node, const Parents&... parents) noexcept :
-        node_type_{utility::type_hash<std::decay_t<Node>>()}, tokens_(std::move(tokens))
+    parse_target(token_buffer tokens, const Node& node, const Parents&... parents) noexcept :
+        node_type_{utility::type_hash<std::decay_t<Node>>()},
+        node_index_{find_node_index<Node, Parents...>()},
+        tokens_(std::move(tokens)),
+        ancestry_{{std::addressof(node), std::addressof(parents)...}},
+        parse_{&invoke<Node, Parents...>}
     {
         static_assert(is_tree_node_v<Node>, "Target must be a tree_node");
-
-        parse_ = [&node, &parents...](parse_target target) -> utility::unsafe_any {
-            if constexpr (std::is_void_v<decltype(node.parse(std::move(target), parents...))>) {
-                node.parse(std::move(target), parents...);
-                return {};
-            } else {
-                return node.parse(std::move(target), parents...);
-            }
-        };
+        static_assert((sizeof...(Parents) + 1) <= config::max_tree_depth,
+                      "Maximum tree depth reached, consider increasing AR_MAX_TREE_DEPTH");
     }
 
     /** No token constructor.
@@ -65,7 +77,7 @@ public:
     // NOLINTNEXTLINE(*-member-init)
     explicit parse_target(const Node& node,  //
                           const Parents&... parents) noexcept :
-        parse_target(vector<token_type>{}, node, parents...)
+        parse_target(token_buffer{}, node, parents...)
     {
     }
 
@@ -73,13 +85,13 @@ public:
      *
      * @return Tokens reference
      */
-    [[nodiscard]] vector<token_type>& tokens() noexcept { return tokens_; }
+    [[nodiscard]] token_buffer& tokens() noexcept { return tokens_; }
 
     /** Const overload.
      *
      * @return Tokens reference
      */
-    [[nodiscard]] const vector<token_type>& tokens() const noexcept { return tokens_; }
+    [[nodiscard]] const token_buffer& tokens() const noexcept { return tokens_; }
 
     /** The sub-targets associated with this target.
      *
@@ -97,7 +109,7 @@ public:
      *
      * @return True if target is invocable (i.e. trigger a parse)
      */
-    [[nodiscard]] explicit operator bool() const noexcept { return static_cast<bool>(parse_); }
+    [[nodiscard]] explicit operator bool() const noexcept { return parse_ != nullptr; }
 
     /** Returns the hash code for the target node.
      *
@@ -105,6 +117,14 @@ public:
      */
     [[nodiscard]] std::size_t node_type() const noexcept { return node_type_; }
 
+    /** Returns the dense index of the target node within the nearest parent that indexes its
+     * descendants.
+     *
+     * This allows an owning node to map a sub-target to its result in constant time.
+     * @return Target node index, or no_index if no parent indexes it
+     */
+    [[nodiscard]] std::size_t node_index() const noexcept { return node_index_; }
+
     /** Append a sub-target.
      *
      * The tokens of @a target are appended to this target.
@@ -112,11 +132,36 @@ public:
      */
     void add_sub_target(parse_target target) { sub_targets_.push_back(std::move(target)); }
 
+    /** Moves the sub-targets of @a target to the end of this target's sub-targets.
+     *
+     * This flattens a nested target into this one with a single insertion, so owners (e.g. modes)
+     * end up with one contiguous sequence of targets to parse.  If @a target has no sub-targets,
+     * then @a target itself is appended.
+     * @param target Target to flatten
+     */
+    void flatten_sub_target(parse_target target)
+    {
+        if (target.sub_targets_.empty()) {
+            add_sub_target(std::move(target));
+            return;
+        }
+
+        sub_targets_.insert(sub_targets_.end(),
+                            std::make_move_iterator(target.sub_targets_.begin()),
+                            std::make_move_iterator(target.sub_targets_.end()));
+    }
+
+    /** Reserves space for @a count sub-targets.
+     *
+     * @param count Number of sub-targets to reserve space for
+     */
+    void reserve_sub_targets(std::size_t count) { sub_targets_.reserve(count); }
+
     /** Set the tokens for this node.
      *
      * @param tokens New tokens
      */
-    void tokens(vector<token_type> tokens) { tokens_ = std::move(tokens); }
+    void tokens(token_buffer tokens) { tokens_ = std::move(tokens); }
 
     /** Trigger the parse of this target.
      *
@@ -125,19 +170,72 @@ public:
     utility::unsafe_any operator()()
     {
         if (parse_) {
-            auto parse = std::move(parse_);
-            parse_ = nullptr;
-            return parse(std::move(*this));
+            // Moving *this into the call only copies the ancestry, so it is still valid to
+            // reference here
+            const auto parse = std::exchange(parse_, nullptr);
+            return parse(ancestry_, std::move(*this));
         }
 
         return {};
     }
 
 private:
+    using ancestry_type = std::array<const void*, config::max_tree_depth>;
+    using invoker_type = utility::unsafe_any (*)(const ancestry_type&, parse_target);
+
+    template <typename Node>
+    struct has_node_index {
+        template <typename Parent>
+        using type = decltype(Parent::template node_index<Node>);
+
+        template <typename Parent>
+        using fn = boost::mp11::mp_valid<type, Parent>;
+    };
+
+    template <typename Node, typename... Parents>
+    [[nodiscard]] constexpr static std::size_t find_node_index() noexcept
+    {
+        using parents_type = boost::mp11::mp_list<std::decay_t<Parents>...>;
+        constexpr auto i =
+            boost::mp11::mp_find_if_q<parents_type, has_node_index<std::decay_t<Node>>>::value;
+
+        if constexpr (i == sizeof...(Parents)) {
+            return no_index;
+        } else {
+            return boost::mp11::mp_at_c<parents_type, i>::template node_index<std::decay_t<Node>>;
+        }
+    }
+
+    template <typename Node, typename... Parents>
+    static utility::unsafe_any invoke(const ancestry_type& ancestry, parse_target target)
+    {
+        return invoke_impl<Node, Parents...>(ancestry,
+                                             std::move(target),
+                                             std::index_sequence_for<Parents...>{});
+    }
+
+    template <typename Node, typename... Parents, std::size_t... I>
+    static utility::unsafe_any invoke_impl(const ancestry_type& ancestry,
+                                           parse_target target,
+                                           std::index_sequence<I...>)
+    {
+        const auto& node = *static_cast<const Node*>(ancestry[0]);
+        if constexpr (std::is_void_v<decltype(node.parse(
+                          std::move(target),
+                          *static_cast<const Parents*>(ancestry[I + 1])...))>) {
+            node.parse(std::move(target), *static_cast<const Parents*>(ancestry[I + 1])...);
+            return {};
+        } else {
+            return node.parse(std::move(target), *static_cast<const Parents*>(ancestry[I + 1])...);
+        }
+    }
+
     std::size_t node_type_;
-    vector<token_type> tokens_;
+    std::size_t node_index_;
+    token_buffer tokens_;
     vector<parse_target> sub_targets_;
-    std::function<utility::unsafe_any(parse_target)> parse_;
+    ancestry_type ancestry_;
+    invoker_type parse_;
 };
 }  // namespace parsing
 
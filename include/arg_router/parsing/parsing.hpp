@@ -28,6 +28,8 @@ using pre_parse_result = utility::result<pre_parse_action, multi_lang_exception>
 
 /** Matches @a token to @a T by comparing the token against the long, short, or none name traits.
  *
+ * If @a token has a cached hash, then it is compared against the compile-time hash of each name
+ * first, so most mismatches are rejected without comparing the strings.
  * @tparam T Type providing the long, short, or none name methods
  * @param token The token to match against
  * @return True if token matches
@@ -35,20 +37,26 @@ using pre_parse_result = utility::result<pre_parse_action, multi_lang_exception>
 template <typename T>
 [[nodiscard]] constexpr bool match(token_type token) noexcept
 {
-    using namespace std::string_literals;
+    const auto hash = token.name_hash();
+    const auto equal = [&](std::string_view name, std::uint32_t name_hash) {
+        return (!hash || (*hash == name_hash)) && (token.name == name);
+    };
 
     if constexpr (traits::has_long_name_method_v<T>) {
-        if ((token.prefix == prefix_type::long_) && (token.name == T::long_name())) {
+        constexpr auto name_hash = hash_name(T::long_name());
+        if ((token.prefix == prefix_type::long_) && equal(T::long_name(), name_hash)) {
             return true;
         }
     }
     if constexpr (traits::has_short_name_method_v<T>) {
-        if ((token.prefix == prefix_type::short_) && (token.name == T::short_name())) {
+        constexpr auto name_hash = hash_name(T::short_name());
+        if ((token.prefix == prefix_type::short_) && equal(T::short_name(), name_hash)) {
             return true;
         }
     }
     if constexpr (traits::has_none_name_method_v<T>) {
-        if ((token.prefix == prefix_type::none) && (token.name == T::none_name())) {
+        constexpr auto name_hash = hash_name(T::none_name());
+        if ((token.prefix == prefix_type::none) && equal(T::none_name(), name_hash)) {
             return true;
         }
     }
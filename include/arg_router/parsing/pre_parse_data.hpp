@@ -5,9 +5,42 @@
 #pragma once
 
 #include "arg_router/parsing/parse_target.hpp"
+#include "arg_router/parsing/parsing.hpp"
+#include "arg_router/parsing/token_list.hpp"
+
+#include <optional>
 
 namespace arg_router::parsing
 {
+/** Node-level pre-parse result type.
+ *
+ * An empty parse_target means that the node cannot consume the leading tokens, and so the caller
+ * should try the next node.  An error means that the tokens are for the node but are invalid, and
+ * so the caller should stop and return the error.
+ */
+using pre_parse_target_result = utility::result<std::optional<parse_target>, multi_lang_exception>;
+
+/** Converts a pre_parse_data validator return value into a pre_parse_result.
+ *
+ * @param valid True if the node should be used
+ * @return parsing::pre_parse_action::valid_node if @a valid is true, otherwise
+ * parsing::pre_parse_action::skip_node
+ */
+[[nodiscard]] inline pre_parse_result validation_result(bool valid) noexcept
+{
+    return valid ? pre_parse_action::valid_node : pre_parse_action::skip_node;
+}
+
+/** Overload for validators that can reject a node with an error.
+ *
+ * @param result Validator return value
+ * @return @a result
+ */
+[[nodiscard]] inline pre_parse_result validation_result(pre_parse_result result) noexcept
+{
+    return result;
+}
+
 namespace detail
 {
 struct always_returns_true {
@@ -36,13 +69,13 @@ public:
      *
      * @return Arg list
      */
-    [[nodiscard]] vector<parsing::token_type>& args() noexcept { return args_; }
+    [[nodiscard]] token_list& args() noexcept { return args_; }
 
     /** Const overload.
      *
      * @return Arg list
      */
-    [[nodiscard]] const vector<parsing::token_type>& args() const noexcept { return args_; }
+    [[nodiscard]] const token_list& args() const noexcept { return args_; }
 
     /** Returns the validator reference.
      *
@@ -52,7 +85,7 @@ public:
 
 protected:
     explicit pre_parse_data_base(
-        vector<parsing::token_type>& args,
+        token_list& args,
         const Validator& validator = [](const auto&...) { return true; }) noexcept :
         args_{args},
         validator_{validator}
@@ -60,7 +93,7 @@ protected:
     }
 
 private:
-    std::reference_wrapper<vector<parsing::token_type>> args_;
+    std::reference_wrapper<token_list> args_;
     std::reference_wrapper<const Validator> validator_;
 };
 
@@ -74,7 +107,7 @@ private:
  * There are two specialisations of pre_parse_data, one that carries a parse_target reference and
  * one that doesn't.  The difference is invisible at construction, but changes how it is used:
  * @code
- * auto args = std::vector<parsing::token_type>{"-f"};
+ * auto args = parsing::token_list{{parsing::prefix_type::none, "-f"}};
  * auto ppd = parsing::pre_parse_data{args};
  * ...
  * auto target = parsing::parse_target{node, parents...};
@@ -100,7 +133,9 @@ class pre_parse_data;
  *     bool operator()(const Node&, const Parents&...);
  * };
  * @endcode
- * If the validator returns true then the result is kept.
+ * If the validator returns true then the result is kept.  A validator may instead return a
+ * pre_parse_result, so it can reject the node with an error which the <TT>pre_parse(..)</TT>
+ * method then returns.
  *
  * @tparam Validator Validation checker type
  */
@@ -113,7 +148,7 @@ public:
      * @param args Unprocessed tokens
      * @param validator Validator instance, defaults to always returning true
      */
-    explicit pre_parse_data(vector<parsing::token_type>& args,
+    explicit pre_parse_data(token_list& args,
                             const Validator& validator = detail::always_returns_true{}) noexcept :
         pre_parse_data_base<Validator, false>{args, validator}
     {
@@ -131,7 +166,9 @@ public:
  *     bool operator()(const Node&, const Parents&...);
  * };
  * @endcode
- * If the validator returns true then the result is kept.
+ * If the validator returns true then the result is kept.  A validator may instead return a
+ * pre_parse_result, so it can reject the node with an error which the <TT>pre_parse(..)</TT>
+ * method then returns.
  *
  * @tparam Validator Validation checker
  */
@@ -145,7 +182,7 @@ public:
      * @param target Processed parse target from parent
      * @param validator Validator instance, defaults to always returning true
      */
-    pre_parse_data(vector<parsing::token_type>& args,
+    pre_parse_data(token_list& args,
                    const parse_target& target,
                    const Validator& validator = detail::always_returns_true{}) noexcept :
         pre_parse_data_base<Validator, true>{args, validator},
@@ -165,16 +202,15 @@ private:
 
 // Deduction guides
 template <typename... T>
-pre_parse_data(vector<parsing::token_type>&) -> pre_parse_data<detail::always_returns_true, false>;
+pre_parse_data(token_list&) -> pre_parse_data<detail::always_returns_true, false>;
 
 template <typename T>
-pre_parse_data(vector<parsing::token_type>&, const T&) -> pre_parse_data<T, false>;
+pre_parse_data(token_list&, const T&) -> pre_parse_data<T, false>;
 
 template <typename... T>
-pre_parse_data(vector<parsing::token_type>&, const parse_target&)
+pre_parse_data(token_list&, const parse_target&)
     -> pre_parse_data<detail::always_returns_true, true>;
 
 template <typename T>
-pre_parse_data(vector<parsing::token_type>&, const parse_target&, const T&)
-    -> pre_parse_data<T, true>;
+pre_parse_data(token_list&, const parse_target&, const T&) -> pre_parse_data<T, true>;
 }  // namespace arg_router::parsing
@@ -0,0 +1,208 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "arg_router/exception.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace arg_router::parsing
+{
+namespace detail
+{
+enum class char_class : std::uint8_t { plain, whitespace, special };
+
+// Scanning a token is then a single table lookup per byte, rather than a comparison against each of
+// the whitespace, quote, and backslash characters
+constexpr auto char_classes = []() {
+    auto table = std::array<char_class, 256>{};
+    for (auto c : {' ', '\t', '\n', '\r', '\v', '\f'}) {
+        table[static_cast<unsigned char>(c)] = char_class::whitespace;
+    }
+    for (auto c : {'\'', '"', '\\'}) {
+        table[static_cast<unsigned char>(c)] = char_class::special;
+    }
+    return table;
+}();
+
+[[nodiscard]] constexpr char_class classify_char(char c) noexcept
+{
+    return char_classes[static_cast<unsigned char>(c)];
+}
+
+[[nodiscard]] constexpr bool is_shell_whitespace(char c) noexcept
+{
+    return classify_char(c) == char_class::whitespace;
+}
+
+[[nodiscard]] constexpr bool is_double_quote_escapable(char c) noexcept
+{
+    return (c == '"') || (c == '\\') || (c == '$') || (c == '`') || (c == '\n');
+}
+
+// Reads the token starting at @a it (which must not be whitespace), writing its unescaped
+// characters to @a out and leaving @a it one-past-the-end of the raw token.  The output is never
+// longer than the input, so @a out may point into the input (at or before @a it) to unescape in
+// place.  Characters are only written when the output position differs from the input position,
+// so a token with no quotes or escapes is left untouched
+[[nodiscard]] inline char* unescape_token(const char*& it, const char* last, char* out)
+{
+    const auto copy = [&]() {
+        if (out != it) {
+            *out = *it;
+        }
+        ++out;
+        ++it;
+    };
+    const auto at_closing_quote = [&](char quote) {
+        if (it == last) {
+            throw multi_lang_exception{error_code::unterminated_quote};
+        }
+        return *it == quote;
+    };
+
+    while ((it != last) && !is_shell_whitespace(*it)) {
+        if (*it == '\\') {
+            // A trailing backslash is dropped, and a backslash-newline pair is a line continuation
+            if (++it == last) {
+                break;
+            }
+            if (*it == '\n') {
+                ++it;
+            } else {
+                copy();
+            }
+        } else if (*it == '\'') {
+            for (++it; !at_closing_quote('\'');) {
+                copy();
+            }
+            ++it;
+        } else if (*it == '"') {
+            for (++it; !at_closing_quote('"');) {
+                if ((*it == '\\') && ((it + 1) != last) && is_double_quote_escapable(*(it + 1))) {
+                    if (*(++it) == '\n') {
+                        ++it;
+                        continue;
+                    }
+                }
+                copy();
+            }
+            ++it;
+        } else {
+            copy();
+        }
+    }
+
+    return out;
+}
+}  // namespace detail
+
+/** Splits @a buffer into tokens using POSIX shell-like rules, modifying @a buffer in place to
+ * remove the quotes and escapes.
+ *
+ * Tokens are separated by unquoted whitespace.  Single quotes preserve everything up to the next
+ * single quote; double quotes do the same except that a backslash escapes a following
+ * <TT>"</TT>, <TT>\\</TT>, <TT>$</TT>, <TT>`</TT>, or newline; and an unquoted backslash escapes
+ * any following character.  Adjacent quoted and unquoted parts form a single token.  No variable
+ * expansion, globbing, or comment handling is performed.
+ *
+ * The tokens passed to @a fn view @a buffer, so no allocation is performed.  Tokens without quotes
+ * or escapes are not written to.
+ * @tparam Fn Callable type with signature <TT>void(std::string_view)</TT>
+ * @param buffer Characters to split
+ * @param fn Called with each token in order
+ * @exception multi_lang_exception Thrown if a quote is not terminated
+ */
+template <typename Fn>
+void shell_split_in_place(span<char> buffer, Fn&& fn)
+{
+    const char* it = buffer.data();
+    const char* last = it + buffer.size();
+    while (true) {
+        while ((it != last) && detail::is_shell_whitespace(*it)) {
+            ++it;
+        }
+        if (it == last) {
+            return;
+        }
+
+        auto* first = buffer.data() + (it - buffer.data());
+        const auto* token_last = detail::unescape_token(it, last, first);
+        fn(std::string_view{first, static_cast<std::size_t>(token_last - first)});
+    }
+}
+
+/** Splits @a input into tokens using the same rules as shell_split_in_place(span<char>, Fn&&),
+ * without modifying it.
+ *
+ * Tokens without quotes or escapes view @a input directly.  Only the tokens with them are copied,
+ * unescaped, into @a arena - which is sized to @a input on the first such token, so it is allocated
+ * at most once per call (and not at all if its capacity is already large enough).  The tokens
+ * remain valid while @a input and @a arena are unmodified.
+ * @tparam Fn Callable type with signature <TT>void(std::string_view)</TT>
+ * @param input Characters to split
+ * @param arena Storage for unescaped tokens, any existing contents are discarded
+ * @param fn Called with each token in order
+ * @exception multi_lang_exception Thrown if a quote is not terminated
+ */
+template <typename Fn>
+void shell_split(std::string_view input, string& arena, Fn&& fn)
+{
+    const char* it = input.data();
+    const char* last = it + input.size();
+    char* out = nullptr;
+    while (true) {
+        while ((it != last) && detail::is_shell_whitespace(*it)) {
+            ++it;
+        }
+        if (it == last) {
+            return;
+        }
+
+        const auto* first = it;
+        it = std::find_if(it, last, [](char c) {
+            return detail::classify_char(c) != detail::char_class::plain;
+        });
+        if ((it == last) || detail::is_shell_whitespace(*it)) {
+            fn(std::string_view{first, static_cast<std::size_t>(it - first)});
+            continue;
+        }
+
+        // The unescaped output of all the tokens cannot be longer than the input
+        if (!out) {
+            arena.clear();
+            arena.resize(input.size());
+            out = arena.data();
+        }
+
+        auto* token_first = out;
+        out = std::copy(first, it, out);
+        out = detail::unescape_token(it, last, out);
+        fn(std::string_view{token_first, static_cast<std::size_t>(out - token_first)});
+    }
+}
+
+/** Splits @a buffer into NUL-separated tokens.
+ *
+ * A trailing NUL does not produce an empty token, so the output of e.g. <TT>find -print0</TT> can
+ * be used directly.
+ * @tparam Fn Callable type with signature <TT>void(std::string_view)</TT>
+ * @param buffer Characters to split
+ * @param fn Called with each token in order
+ */
+template <typename Fn>
+void nul_split(span<const char> buffer, Fn&& fn)
+{
+    auto view = std::string_view{buffer.data(), buffer.size()};
+    while (!view.empty()) {
+        const auto pos = std::min(view.find('\0'), view.size());
+        fn(view.substr(0, pos));
+        view.remove_prefix(std::min(pos + 1, view.size()));
+    }
+}
+}  // namespace arg_router::parsing
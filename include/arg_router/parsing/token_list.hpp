@@ -0,0 +1,250 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "arg_router/parsing/token_type.hpp"
+
+#include <algorithm>
+
+namespace arg_router::parsing
+{
+/** A list of tokens that can be consumed from the front in constant time.
+ *
+ * This is used to hold the unprocessed tokens during the pre-parse phase.  As the tokens are almost
+ * always consumed from the front, erasing from the front just advances a head index rather than
+ * shifting all the remaining tokens along.  Inserting at the front re-uses the consumed slots if
+ * there are enough of them.
+ *
+ * The interface is a subset of <TT>std::vector</TT>'s, and the iterators are invalidated by the
+ * same operations.
+ */
+class token_list
+{
+public:
+    /** Value type. */
+    using value_type = token_type;
+    /** Size type. */
+    using size_type = std::size_t;
+    /** Difference type. */
+    using difference_type = std::ptrdiff_t;
+    /** Reference type. */
+    using reference = value_type&;
+    /** Const reference type. */
+    using const_reference = const value_type&;
+    /** Iterator type. */
+    using iterator = vector<value_type>::iterator;
+    /** Const iterator type. */
+    using const_iterator = vector<value_type>::const_iterator;
+
+    /** Default constructor. */
+    token_list() noexcept : head_{0} {}
+
+    /** Constructor.
+     *
+     * @param tokens Initial tokens
+     */
+    token_list(std::initializer_list<value_type> tokens) : tokens_(tokens), head_{0} {}
+
+    /** Constructor.
+     *
+     * Implicit so that a list can be created wherever a token vector is available.
+     * @param tokens Initial tokens
+     */
+    // NOLINTNEXTLINE(google-explicit-constructor,hicpp-explicit-conversions)
+    token_list(vector<value_type> tokens) noexcept : tokens_(std::move(tokens)), head_{0} {}
+
+    /** Returns an iterator to the first token.
+     *
+     * @return Begin iterator
+     */
+    [[nodiscard]] iterator begin() noexcept { return tokens_.begin() + head_; }
+
+    /** Const overload.
+     *
+     * @return Begin iterator
+     */
+    [[nodiscard]] const_iterator begin() const noexcept { return tokens_.begin() + head_; }
+
+    /** Returns a one-past-the-end iterator.
+     *
+     * @return End iterator
+     */
+    [[nodiscard]] iterator end() noexcept { return tokens_.end(); }
+
+    /** Const overload.
+     *
+     * @return End iterator
+     */
+    [[nodiscard]] const_iterator end() const noexcept { return tokens_.end(); }
+
+    /** Returns the number of tokens.
+     *
+     * @return Token count
+     */
+    [[nodiscard]] size_type size() const noexcept { return tokens_.size() - head_; }
+
+    /** @return True if there are no tokens.
+     */
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    /** Returns the first token.
+     *
+     * @note Undefined if the list is empty
+     * @return First token
+     */
+    [[nodiscard]] reference front() noexcept { return tokens_[head_]; }
+
+    /** Const overload.
+     *
+     * @note Undefined if the list is empty
+     * @return First token
+     */
+    [[nodiscard]] const_reference front() const noexcept { return tokens_[head_]; }
+
+    /** Index operator.
+     *
+     * @note Undefined if @a i is out of bounds
+     * @param i Index
+     * @return Token at @a i
+     */
+    [[nodiscard]] reference operator[](size_type i) noexcept { return tokens_[head_ + i]; }
+
+    /** Const overload.
+     *
+     * @note Undefined if @a i is out of bounds
+     * @param i Index
+     * @return Token at @a i
+     */
+    [[nodiscard]] const_reference operator[](size_type i) const noexcept
+    {
+        return tokens_[head_ + i];
+    }
+
+    /** Reserve space for at least @a count tokens, not including any consumed slots.
+     *
+     * @param count Number of tokens to reserve space for
+     */
+    void reserve(size_type count) { tokens_.reserve(head_ + count); }
+
+    /** Removes all the tokens. */
+    void clear() noexcept
+    {
+        tokens_.clear();
+        head_ = 0;
+    }
+
+    /** Appends @a value.
+     *
+     * @param value Token to append
+     */
+    void push_back(value_type value) { tokens_.push_back(value); }
+
+    /** Constructs a token in-place at the end.
+     *
+     * @tparam Args Constructor argument types
+     * @param args Constructor arguments
+     * @return Reference to the new token
+     */
+    template <typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        return tokens_.emplace_back(std::forward<Args>(args)...);
+    }
+
+    /** Inserts @a value at @a pos.
+     *
+     * If @a pos is the beginning and a consumed slot is available, this is constant time.
+     * @param pos Position to insert at
+     * @param value Token to insert
+     * @return Iterator to the inserted token
+     */
+    iterator insert(const_iterator pos, value_type value)
+    {
+        if ((pos == begin()) && (head_ > 0)) {
+            tokens_[--head_] = value;
+            return begin();
+        }
+
+        return tokens_.insert(pos, value);
+    }
+
+    /** Inserts the tokens in the range [ @a first, @a last ) at @a pos.
+     *
+     * If @a pos is the beginning and there are enough consumed slots available, then they are
+     * re-used rather than shifting the existing tokens.
+     * @tparam Iter Forward iterator type
+     * @param pos Position to insert at
+     * @param first Iterator to the first token to insert
+     * @param last One-past-the-end iterator of the tokens to insert
+     * @return Iterator to the first inserted token
+     */
+    template <typename Iter>
+    iterator insert(const_iterator pos, Iter first, Iter last)
+    {
+        const auto count = static_cast<size_type>(std::distance(first, last));
+        if ((pos == begin()) && (count <= head_)) {
+            head_ -= count;
+            std::copy(first, last, begin());
+            return begin();
+        }
+
+        return tokens_.insert(pos, first, last);
+    }
+
+    /** Removes the token at @a pos.
+     *
+     * Constant time if @a pos is the beginning.
+     * @param pos Position of the token to remove
+     * @return Iterator to the token following the removed one
+     */
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+    /** Removes the tokens in the range [ @a first, @a last ).
+     *
+     * Constant time if @a first is the beginning.
+     * @param first Iterator to the first token to remove
+     * @param last One-past-the-end iterator of the tokens to remove
+     * @return Iterator to the token following the last removed one
+     */
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        if (first == begin()) {
+            head_ += static_cast<size_type>(std::distance(first, last));
+            if (head_ == tokens_.size()) {
+                clear();
+            }
+            return begin();
+        }
+
+        return tokens_.erase(first, last);
+    }
+
+    /** Equality operator.
+     *
+     * @param lhs First instance
+     * @param rhs Second instance
+     * @return True if both hold the same tokens
+     */
+    [[nodiscard]] friend bool operator==(const token_list& lhs, const token_list& rhs) noexcept
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    /** Inequality operator.
+     *
+     * @param lhs First instance
+     * @param rhs Second instance
+     * @return True if the tokens differ
+     */
+    [[nodiscard]] friend bool operator!=(const token_list& lhs, const token_list& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    vector<value_type> tokens_;
+    size_type head_;
+};
+}  // namespace arg_router::parsing
@@ -5,8 +5,12 @@
 #pragma once
 
 #include "arg_router/traits.hpp"
+#include "arg_router/utility/small_vector.hpp"
 #include "arg_router/utility/string_view_ops.hpp"
 
+#include <cstdint>
+#include <optional>
+
 namespace arg_router::parsing
 {
 /** Enum for the prefix type on a token. */
@@ -31,6 +35,22 @@ enum class prefix_type : std::uint8_t {
     }
 }
 
+/** Generates a hash of @a name, used to quickly reject mismatching token names.
+ *
+ * This is a 32-bit FNV-1a hash, so it can be used at compile-time on node names.
+ * @param name Token name, stripped of prefix (if any)
+ * @return Hash of @a name
+ */
+[[nodiscard]] constexpr std::uint32_t hash_name(std::string_view name) noexcept
+{
+    auto hash = std::uint32_t{2166136261u};
+    for (auto c : name) {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= std::uint32_t{16777619u};
+    }
+    return hash;
+}
+
 /** Pair-like structure carrying the token's prefix type and the token itself (stripped of prefix).
  */
 struct token_type {
@@ -43,6 +63,7 @@ struct token_type {
 
     /** Equality operator.
      *
+     * The cached classification and hash are not compared.
      * @param other Instance to compare against
      * @return True if equal
      */
@@ -61,7 +82,33 @@ struct token_type {
         return !(*this == other);
     }
 
-    prefix_type prefix;     ///< Prefix type
+    /** Returns the hash of @a name, if it is cached.
+     *
+     * @return Hash of @a name, or an empty optional if not known
+     */
+    [[nodiscard]] constexpr std::optional<std::uint32_t> name_hash() const noexcept
+    {
+        // For an unprocessed token, the hash is of the name with the classification's prefix
+        // stripped, so it is only usable if that prefix is empty
+        if (!classification || (*classification == prefix_type::none)) {
+            return hash;
+        }
+        return {};
+    }
+
+    prefix_type prefix;  ///< Prefix type
+
+    /** If @a prefix is prefix_type::none, then this can hold the prefix type that name would be
+     * given by get_token_type(std::string_view), so it does not need re-calculating.  Set by
+     * classify(std::string_view).
+     */
+    std::optional<prefix_type> classification;
+
+    /** Hash (from hash_name(std::string_view)) of @a name stripped of the prefix given by
+     * @a classification, if set.  Use name_hash() to access it.
+     */
+    std::optional<std::uint32_t> hash;
+
     std::string_view name;  ///< Token name, stripped of prefix (if any)
 };
 
@@ -77,12 +124,17 @@ struct token_type {
     return to_string(token.prefix) + token.name;
 }
 
-/** Creates a string representation of @a view.
+/** Token storage for parse targets and pre-parse scratch buffers.
  *
- * @param view Processed tokens to convert
- * @return String representation of @a view
+ * Most nodes consume a label token and at most one value token, so two tokens are held inline to
+ * avoid heap allocations in the common case.
  */
-[[nodiscard]] inline string to_string(const vector<token_type>& view)
+using token_buffer = utility::small_vector<token_type, 2>;
+
+namespace detail
+{
+template <typename Container>
+[[nodiscard]] string tokens_to_string(const Container& view)
 {
     auto str = string{};
     for (auto i = 0u; i < view.size(); ++i) {
@@ -93,6 +145,27 @@ struct token_type {
     }
     return str;
 }
+}  // namespace detail
+
+/** Creates a string representation of @a view.
+ *
+ * @param view Processed tokens to convert
+ * @return String representation of @a view
+ */
+[[nodiscard]] inline string to_string(const vector<token_type>& view)
+{
+    return detail::tokens_to_string(view);
+}
+
+/** Creates a string representation of @a view.
+ *
+ * @param view Processed tokens to convert
+ * @return String representation of @a view
+ */
+[[nodiscard]] inline string to_string(const token_buffer& view)
+{
+    return detail::tokens_to_string(view);
+}
 
 /** Analyse @a token and return a pair consisting of the prefix type and @a token stripped of the
  * token.
@@ -115,6 +188,42 @@ struct token_type {
     return {prefix_type::none, token};
 }
 
+/** Creates an unprocessed token (i.e. with a prefix_type::none prefix) from a raw command line
+ * token, with its classification cached.
+ *
+ * Tokens are typically tested against the names of many nodes during a parse, so the root
+ * classifies each one up front and the get_token_type(const token_type&) overloads can then avoid
+ * repeatedly checking the prefixes.  The hash of the stripped name is cached too, for match().
+ * @param token Raw command line token
+ * @return Unprocessed token
+ */
+[[nodiscard]] inline token_type classify(std::string_view token)
+{
+    const auto processed = get_token_type(token);
+
+    auto result = token_type{prefix_type::none, token};
+    result.classification = processed.prefix;
+    result.hash = hash_name(processed.name);
+    return result;
+}
+
+/** Overload for an unprocessed token, using the cached classification if available.
+ *
+ * @param token Unprocessed token to analyse
+ * @return Token type
+ */
+[[nodiscard]] inline token_type get_token_type(const token_type& token)
+{
+    if (!token.classification) {
+        return get_token_type(token.name);
+    }
+
+    auto result = token_type{*token.classification,
+                             token.name.substr(to_string(*token.classification).size())};
+    result.hash = token.hash;
+    return result;
+}
+
 /** Overload that uses the naming policies of @a node to control the output.
  *
  * If the target node is available, this should be the preferred overload.
@@ -144,4 +253,35 @@ template <typename Node>
     }
     return {prefix_type::none, token};
 }
+
+/** Overload for an unprocessed token, using the cached classification if available.
+ *
+ * @tparam Node Target node type
+ * @param node Node instance
+ * @param token Unprocessed token to analyse
+ * @return Token type
+ */
+template <typename Node>
+[[nodiscard]] inline token_type get_token_type(const Node& node, const token_type& token)
+{
+    if (!token.classification) {
+        return get_token_type(node, token.name);
+    }
+
+    // A node only accepts the prefix types that it has names for, otherwise the token is left
+    // as-is
+    const auto prefix = *token.classification;
+    if (((prefix == prefix_type::long_) && traits::has_long_name_method_v<Node>) ||
+        ((prefix == prefix_type::short_) && traits::has_short_name_method_v<Node>)) {
+        auto result = token_type{prefix, token.name.substr(to_string(prefix).size())};
+        result.hash = token.hash;
+        return result;
+    }
+
+    auto result = token_type{prefix_type::none, token.name};
+    if (prefix == prefix_type::none) {
+        result.hash = token.hash;
+    }
+    return result;
+}
 }  // namespace arg_router::parsing
@@ -8,21 +8,23 @@
 
 namespace arg_router::parsing
 {
-/** Throws a multi_lang_exception with either a error_code::unknown_argument or a
+/** Creates a multi_lang_exception with either a error_code::unknown_argument or a
  * error_code::unknown_argument_with_suggestion if the data is available.
  *
- * @tparam Node Node type throwing the exception
- * @param node Node throwing the exception, used as a source for the
+ * @tparam Node Node type raising the error
+ * @param node Node raising the error, used as a source for the
  * utility::utf8::closest_matching_child_node(const Node& node, parsing::token_type token)
- * @param unknown_token The token that caused the exception to be thrown
+ * @param unknown_token The token that caused the error
+ * @return Exception representing the error
  */
 template <typename Node>
-[[noreturn]] void unknown_argument_exception(const Node& node, token_type unknown_token)
+[[nodiscard]] multi_lang_exception unknown_argument_error(const Node& node,
+                                                          token_type unknown_token)
 {
     auto matching_node_and_parents =
         utility::utf8::closest_matching_child_node(node, unknown_token);
     if (matching_node_and_parents.empty()) {
-        throw multi_lang_exception{error_code::unknown_argument, unknown_token};
+        return multi_lang_exception{error_code::unknown_argument, unknown_token};
     }
 
     auto tokens = vector<parsing::token_type>{unknown_token};
@@ -31,6 +33,18 @@ template <typename Node>
                   matching_node_and_parents.rbegin(),
                   matching_node_and_parents.rend());
 
-    throw multi_lang_exception{error_code::unknown_argument_with_suggestion, tokens};
+    return multi_lang_exception{error_code::unknown_argument_with_suggestion, std::move(tokens)};
+}
+
+/** Throws the result of unknown_argument_error(const Node&, token_type).
+ *
+ * @tparam Node Node type throwing the exception
+ * @param node Node throwing the exception
+ * @param unknown_token The token that caused the exception to be thrown
+ */
+template <typename Node>
+[[noreturn]] void unknown_argument_exception(const Node& node, token_type unknown_token)
+{
+    throw unknown_argument_error(node, std::move(unknown_token));
 }
 }  // namespace arg_router::parsing
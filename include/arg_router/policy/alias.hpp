@@ -105,7 +105,7 @@ public:
             if (alias_label.prefix == parsing::prefix_type::none) {
                 alias_label =
                     parsing::get_token_type(std::get<0>(std::tuple{std::cref(parents)...}).get(),
-                                            alias_label.name);
+                                            alias_label);
             }
 
             if (!parsing::match<node_type>(alias_label)) {
@@ -125,7 +125,7 @@ public:
                 boost::mp11::mp_set_intersection<aliased_policies_type, policies_type>;
 
             if constexpr ((std::tuple_size_v<intersection>) > 0) {
-                auto target_tokens = vector<parsing::token_type>{};
+                auto target_tokens = parsing::token_buffer{};
                 target_tokens.reserve(count);
 
                 auto value_it = tokens.begin();
@@ -0,0 +1,69 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "arg_router/policy/policy.hpp"
+
+namespace arg_router::policy
+{
+/** Collects the owning mode's child results into an instance of @a T, which is then passed to the
+ * router instead of the individual results.
+ *
+ * @a T must be an aggregate whose members are initialisable from the child value types, in the
+ * same order as the children that produce a value (i.e. excluding any with a
+ * policy::no_result_value).
+ *
+ * The owning mode must have a policy::router, and this policy can only be used in a mode.
+ * @code
+ * struct args {
+ *     bool force;
+ *     std::vector<std::filesystem::path> srcs;
+ * };
+ *
+ * ar::mode(ar::flag("force"_S),
+ *          ar::positional_arg<std::vector<std::filesystem::path>>("SRC"_S),
+ *          arp::bind_to<args>,
+ *          arp::router{[](args a) { ... }});
+ * @endcode
+ * @note The child results are still collected into the mode's per-child <TT>std::optional</TT>
+ * storage first, as the tokens can arrive in any order and missing values are filled in after
+ * token processing.  Each result is then moved once from there into the aggregate, so @a T's
+ * members should be cheap to move
+ * @tparam T Aggregate type to bind to
+ */
+template <typename T>
+class bind_to_t
+{
+public:
+    /** Aggregate type. */
+    using value_type = T;
+
+    /** Constructor. */
+    constexpr bind_to_t() noexcept = default;
+
+    /** Creates the aggregate from the child results.
+     *
+     * @tparam Args Child result types
+     * @param args Child results
+     * @return Aggregate instance
+     */
+    template <typename... Args>
+    [[nodiscard]] constexpr static value_type bind(Args&&... args)
+    {
+        return value_type{std::forward<Args>(args)...};
+    }
+};
+
+/** Constant variable helper.
+ *
+ * @tparam T Aggregate type to bind to
+ */
+template <typename T>
+constexpr auto bind_to = bind_to_t<T>{};
+
+template <typename T>
+struct is_policy<bind_to_t<T>> : std::true_type {
+};
+}  // namespace arg_router::policy
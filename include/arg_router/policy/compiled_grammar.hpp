@@ -0,0 +1,261 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "arg_router/algorithm.hpp"
+#include "arg_router/parsing/name_dispatch_table.hpp"
+#include "arg_router/parsing/pre_parse_data.hpp"
+#include "arg_router/parsing/token_list.hpp"
+#include "arg_router/policy/policy.hpp"
+#include "arg_router/traits.hpp"
+#include "arg_router/tree_node_fwd.hpp"
+
+#include <boost/mp11/algorithm.hpp>
+
+#include <algorithm>
+#include <array>
+#include <optional>
+
+namespace arg_router
+{
+template <typename... Params>
+class mode_t;
+
+namespace policy
+{
+namespace detail
+{
+struct grammar_transition {
+    std::string_view name;
+    std::size_t index;
+    bool enterable;
+};
+
+[[nodiscard]] constexpr bool grammar_transition_less(const grammar_transition& lhs,
+                                                     const grammar_transition& rhs) noexcept
+{
+    if (lhs.name != rhs.name) {
+        return lhs.name < rhs.name;
+    }
+    return lhs.index < rhs.index;
+}
+
+// A mode can be entered on its name alone if it has no pre-parse phase policies, as those (e.g.
+// policy::runtime_enable) have to run when its label is matched
+template <typename Child>
+[[nodiscard]] constexpr bool is_static_mode() noexcept
+{
+    if constexpr (traits::is_specialisation_of_v<Child, mode_t> &&
+                  traits::has_none_name_method_v<Child>) {
+        return boost::mp11::mp_none_of<typename Child::policies_type,
+                                       policy::has_pre_parse_phase_method>::value;
+    } else {
+        return false;
+    }
+}
+
+// The root tries all of its children for the front token, whereas a mode only tries its child
+// modes
+template <typename Node, typename Child>
+constexpr bool is_grammar_candidate =
+    !traits::is_specialisation_of_v<Node, mode_t> || traits::is_specialisation_of_v<Child, mode_t>;
+
+template <typename Node>
+class grammar_transitions
+{
+    using children_type = typename Node::children_type;
+
+    template <std::size_t I>
+    using child_type = std::tuple_element_t<I, children_type>;
+
+    template <std::size_t I>
+    constexpr static bool has_entry = is_grammar_candidate<Node, child_type<I>> &&
+                                      parsing::detail::is_name_dispatchable<child_type<I>>::value &&
+                                      traits::has_none_name_method_v<child_type<I>>;
+
+    template <std::size_t... I>
+    [[nodiscard]] constexpr static std::size_t first_undispatchable(
+        std::index_sequence<I...> /*indices*/) noexcept
+    {
+        const auto undispatchable = std::array<bool, sizeof...(I)>{
+            (is_grammar_candidate<Node, child_type<I>> &&
+             !parsing::detail::is_name_dispatchable<child_type<I>>::value)...};
+        for (auto i = std::size_t{0}; i < undispatchable.size(); ++i) {
+            if (undispatchable[i]) {
+                return i;
+            }
+        }
+        return undispatchable.size();
+    }
+
+    // A child can only be entered directly if every candidate child before it is skipped by the
+    // name lookup too, otherwise the earlier child may accept the token first
+    template <std::size_t... I>
+    [[nodiscard]] constexpr static auto build(std::index_sequence<I...> /*indices*/) noexcept
+    {
+        constexpr auto first = first_undispatchable(std::index_sequence<I...>{});
+
+        auto entries =
+            std::array<grammar_transition, ((has_entry<I> ? 1 : 0) + ... + 0)>{};
+        [[maybe_unused]] auto pos = std::size_t{0};
+        (
+            [&]() {
+                if constexpr (has_entry<I>) {
+                    entries[pos++] =
+                        grammar_transition{child_type<I>::none_name(),
+                                           I,
+                                           is_static_mode<child_type<I>>() &&
+                                               (I < first)};
+                }
+            }(),
+            ...);
+
+        // Insertion sort, as the std algorithms are not constexpr in C++17
+        for (auto i = std::size_t{1}; i < entries.size(); ++i) {
+            const auto value = entries[i];
+            auto j = i;
+            for (; (j > 0) && grammar_transition_less(value, entries[j - 1]); --j) {
+                entries[j] = entries[j - 1];
+            }
+            entries[j] = value;
+        }
+
+        return entries;
+    }
+
+public:
+    constexpr static auto num_children = std::tuple_size_v<children_type>;
+
+    constexpr static auto entries =
+        build(std::make_index_sequence<std::tuple_size_v<children_type>>{});
+
+    // Returns the index of the child mode to enter for @a token, or num_children if the token
+    // does not name one
+    [[nodiscard]] static std::size_t find(const parsing::token_type& token) noexcept
+    {
+        if (token.prefix != parsing::prefix_type::none) {
+            return num_children;
+        }
+
+        // Entries with the same name are ordered by index, and the lowest is the one that would
+        // be tried first
+        const auto key = grammar_transition{token.name, 0, false};
+        const auto it =
+            std::lower_bound(entries.begin(), entries.end(), key, grammar_transition_less);
+        if ((it == entries.end()) || (it->name != token.name) || !it->enterable) {
+            return num_children;
+        }
+        return it->index;
+    }
+};
+}  // namespace detail
+
+/** Selects the mode for a parse using transition tables generated at compile-time.
+ *
+ * Without this policy, the root tries each of its children against the front token, and each named
+ * mode that matches then tries its child modes against the next token; so a deeply nested mode
+ * is found by trial pre-parses at every level.  With it, each node's child mode names are
+ * collected into a sorted table at compile-time and the leading mode name tokens are walked as
+ * state transitions, one binary search per token, until one no longer names a child mode.  The
+ * selected mode then pre-parses the remaining tokens normally, with its named options found by
+ * jumping directly to the child owning the token rather than testing each child in turn.
+ * Unnamed children (e.g. positional_arg_t) are still tried in order, as are the children behind
+ * them.
+ *
+ * Modes with pre-parse phase policies (e.g. policy::runtime_enable) are not entered directly, the
+ * walk stops at their parent which then pre-parses them normally so the policies can run.
+ * Likewise, if the root's front token does not name a mode then the root falls back to trying
+ * each of its children.  So the parse results, including the errors, are the same with or without
+ * this policy.
+ * @code
+ * ar::root(ar::policy::compiled_grammar,
+ *          ar::policy::validation::default_validator,
+ *          ...);
+ * @endcode
+ * @note The tables are built per node type at compile-time, so they add to the build times of
+ * large parse trees
+ */
+template <typename = void>  // This is needed so it can be used in
+class compiled_grammar_t    // template template parameters
+{
+public:
+    /** Walks the leading mode name tokens in @a tokens from @a root, then pre-parses the selected
+     * mode.
+     *
+     * @tparam Root Root type
+     * @param tokens Tokens to pre-parse, the consumed tokens are removed
+     * @param root Root instance
+     * @return The selected mode's pre-parse result, or empty if the front token does not name a
+     * mode that can be entered directly (in which case @a tokens is unchanged)
+     */
+    template <typename Root>
+    [[nodiscard]] static std::optional<parsing::pre_parse_target_result> pre_parse(
+        parsing::token_list& tokens,
+        const Root& root)
+    {
+        return transition(tokens, 0, root);
+    }
+
+private:
+    template <typename Node, typename... Parents>
+    [[nodiscard]] static std::optional<parsing::pre_parse_target_result> transition(
+        parsing::token_list& tokens,
+        std::size_t pos,
+        const Node& node,
+        const Parents&... parents)
+    {
+        using transitions_type = detail::grammar_transitions<Node>;
+
+        if constexpr (!transitions_type::entries.empty()) {
+            const auto index = (pos < tokens.size()) ? transitions_type::find(tokens[pos]) :
+                                                       transitions_type::num_children;
+            if (index < transitions_type::num_children) {
+                return boost::mp11::mp_with_index<transitions_type::num_children>(
+                    index,
+                    [&](auto i) -> std::optional<parsing::pre_parse_target_result> {
+                        const auto& child = std::get<i>(node.children());
+                        if constexpr (detail::is_static_mode<std::decay_t<decltype(child)>>()) {
+                            return transition(tokens, pos + 1, child, node, parents...);
+                        } else {
+                            // Unreachable, find() only returns indices of static modes
+                            return {};
+                        }
+                    });
+            }
+        }
+
+        if constexpr (sizeof...(Parents) == 0) {
+            // Still at the root, so the front token does not name a mode
+            return {};
+        } else {
+            // Remove the ancestor modes' labels, the selected mode matches its own label during
+            // its pre-parse
+            tokens.erase(tokens.begin(), tokens.begin() + (pos - 1));
+            return node.pre_parse(parsing::pre_parse_data{tokens}, parents...);
+        }
+    }
+};
+
+/** Constant variable helper. */
+constexpr auto compiled_grammar = compiled_grammar_t<>{};
+
+template <>
+struct is_policy<compiled_grammar_t<>> : std::true_type {
+};
+
+/** Evaluates to true if @a Root is a tree node with a compiled_grammar_t policy.
+ *
+ * @tparam Root Root type
+ */
+template <typename Root>
+constexpr bool has_compiled_grammar_v = []() {
+    if constexpr (is_tree_node_v<Root>) {
+        return algorithm::has_specialisation_v<compiled_grammar_t, typename Root::policies_type>;
+    } else {
+        return false;
+    }
+}();
+}  // namespace policy
+}  // namespace arg_router
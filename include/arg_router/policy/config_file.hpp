@@ -0,0 +1,127 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "arg_router/parsing/config_table.hpp"
+#include "arg_router/policy/policy.hpp"
+#include "arg_router/traits.hpp"
+#include "arg_router/utility/mapped_file.hpp"
+
+#include <memory>
+#include <mutex>
+
+namespace arg_router::policy
+{
+/** Root policy that reads the values of nodes missing from the command line from a configuration
+ * file.
+ *
+ * The file format is described in parsing::config_table.  A node's key is its long name, or its
+ * display name if it has no long name, or its short name if it has neither.  Nodes in a named
+ * mode are looked up in the section with that mode's name, other nodes are looked up in the
+ * top-level (before any section header).  Nested modes only use the name of the mode that owns
+ * the node.
+ * @code
+ * # Applies to --threads in the anonymous mode
+ * threads = 4
+ *
+ * [copy]
+ * force = true
+ * @endcode
+ * The value is converted and validated as if it were the node's value token on the command line,
+ * except that flags parse it as a <TT>bool</TT> (or count for counting flags).
+ *
+ * The file is memory-mapped and indexed once, on the first lookup, and then shared by all copies
+ * of the policy - so it is not re-read per node or per parse.  A missing file is treated as
+ * empty.  Command line tokens take precedence over policy::env_fallback_t, which takes precedence
+ * over this policy, which takes precedence over missing phase policies such as
+ * policy::default_value and policy::required.
+ *
+ * The shared state and the index outlive any parse, so they are allocated using the memory
+ * resource that is current when the policy is constructed (see utility::resource_allocator), not
+ * that of the parse that performs the first lookup.
+ */
+template <typename = void>  // This is needed due so it can be used in
+class config_file           // template template parameters
+{
+public:
+    /** Constructor.
+     *
+     * @param path Path to the configuration file
+     */
+    explicit config_file(std::string_view path) :
+        state_{std::allocate_shared<state>(config::allocator<state>{}, string{path})}
+    {
+    }
+
+    /** Returns the configuration file value for @a Node.
+     *
+     * @tparam Node Node type to look up
+     * @tparam Parents Pack of parent tree nodes of @a Node in ascending ancestry order
+     * @param parents Parents instances pack
+     * @return Value, or an empty optional if not set in the file
+     * @exception multi_lang_exception Thrown if a line of the file cannot be parsed
+     */
+    template <typename Node, typename... Parents>
+    [[nodiscard]] std::optional<std::string_view> config_value(
+        [[maybe_unused]] const Parents&... parents) const
+    {
+        std::call_once(state_->loaded, [&]() {
+            if (auto file = utility::mapped_file::open(state_->path)) {
+                state_->file = std::move(*file);
+                state_->table = parsing::config_table::index(state_->file.data(),
+                                                             state_->table.get_allocator());
+            }
+        });
+
+        return state_->table.find(section<Parents...>(), key<Node>());
+    }
+
+private:
+    // The table is default constructed here, so its allocator is fixed at policy construction
+    struct state {
+        explicit state(string p) : path{std::move(p)} {}
+
+        string path;
+        std::once_flag loaded;
+        utility::mapped_file file;
+        parsing::config_table table;
+    };
+
+    template <typename Node>
+    [[nodiscard]] constexpr static std::string_view key() noexcept
+    {
+        if constexpr (traits::has_long_name_method_v<Node>) {
+            return Node::long_name();
+        } else if constexpr (traits::has_display_name_method_v<Node>) {
+            return Node::display_name();
+        } else {
+            static_assert(traits::has_short_name_method_v<Node>,
+                          "Config file values require a named node");
+            return Node::short_name();
+        }
+    }
+
+    template <typename... Parents>
+    [[nodiscard]] constexpr static std::string_view section() noexcept
+    {
+        if constexpr (sizeof...(Parents) > 0) {
+            using owner_type = boost::mp11::mp_first<std::tuple<Parents...>>;
+            if constexpr (traits::has_none_name_method_v<owner_type>) {
+                return owner_type::none_name();
+            } else {
+                return {};
+            }
+        } else {
+            return {};
+        }
+    }
+
+    std::shared_ptr<state> state_;
+};
+
+template <typename T>
+struct is_policy<config_file<T>> : std::true_type {
+};
+}  // namespace arg_router::policy
@@ -188,4 +188,8 @@ template <typename... DependsPolicies>
 template <typename... DependsPolicies>
 struct is_policy<dependent_t<DependsPolicies...>> : std::true_type {
 };
+
+template <typename... DependsPolicies>
+struct supports_name_dispatch<dependent_t<DependsPolicies...>> : std::true_type {
+};
 }  // namespace arg_router::policy
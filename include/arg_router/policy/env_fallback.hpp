@@ -0,0 +1,87 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "arg_router/policy/policy.hpp"
+#include "arg_router/utility/compile_time_string.hpp"
+
+#include <array>
+#include <cstdlib>
+#include <optional>
+
+namespace arg_router::policy
+{
+/** Reads the owning node's value from an environment variable when it is missing from the command
+ * line.
+ *
+ * The value is converted and validated as if it were the node's value token on the command line,
+ * except that flags parse it as a <TT>bool</TT> (or count for counting flags).  Command line tokens
+ * take precedence over this policy, which takes precedence over policy::config_file, which takes
+ * precedence over missing phase policies such as policy::default_value and policy::required.
+ *
+ * If using C++17 then use the template variable helper with the <TT>S_</TT> macro; for C++20 and
+ * higher, use the constructor directly with a compile-time string literal:
+ * @code
+ * constexpr auto a = ar::policy::env_fallback<S_("MYAPP_THREADS")>;
+ * constexpr auto b = ar::policy::env_fallback_t{"MYAPP_THREADS"_S};
+ * @endcode
+ * @tparam S Compile-time string
+ */
+template <typename S>
+class env_fallback_t
+{
+    static_assert(!S::empty(), "Environment variable name must not be empty");
+
+public:
+    /** String type. */
+    using string_type = S;
+
+    /** Constructor.
+     *
+     * @param str String instance
+     */
+    constexpr explicit env_fallback_t([[maybe_unused]] S str = {}) noexcept {}
+
+    /** Returns the environment variable name.
+     *
+     * @return Variable name
+     */
+    [[nodiscard]] constexpr static std::string_view env_variable() noexcept { return S::get(); }
+
+    /** Returns the environment variable's value.
+     *
+     * @return Value, or an empty optional if the variable is not set
+     */
+    [[nodiscard]] static std::optional<std::string_view> env_value() noexcept
+    {
+        // NOLINTNEXTLINE(concurrency-mt-unsafe)
+        if (const auto* value = std::getenv(c_name_.data())) {
+            return value;
+        }
+        return {};
+    }
+
+private:
+    // Compile-time strings are not guaranteed to be null-terminated
+    constexpr static auto c_name_ = []() {
+        auto name = std::array<char, S::size() + 1>{};
+        for (auto i = 0u; i < S::size(); ++i) {
+            name[i] = S::get()[i];
+        }
+        return name;
+    }();
+};
+
+/** Constant variable helper.
+ *
+ * @tparam S Compile-time string
+ */
+template <typename S>
+constexpr auto env_fallback = env_fallback_t<S>{};
+
+template <typename S>
+struct is_policy<env_fallback_t<S>> : std::true_type {
+};
+}  // namespace arg_router::policy
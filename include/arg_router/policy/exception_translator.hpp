@@ -10,6 +10,8 @@
 
 #include <boost/lexical_cast.hpp>
 
+#include <optional>
+
 /** Exception message translator policy.
  *
  * Provides the mapping between the internal multi_lang_exception error code to a translated string,
@@ -47,31 +49,45 @@ class exception_translator_t
                                get_translations_or_default<FallbackTranslationType>>;
 
 public:
-    /** Translates the error code in @a e and re-throws as an parse_exception.
+    /** Translates the error code in @a e into a parse_exception.
      *
      * @param e Exception to translate
-     * @exception parse_exception
+     * @return Translated exception
      */
-    [[noreturn]] static void translate_exception(const multi_lang_exception& e)
+    [[nodiscard]] static parse_exception translate(const multi_lang_exception& e)
     {
+        auto result = std::optional<parse_exception>{};
         utility::tuple_type_iterator<translations>([&](auto i) {
             using entry_type = std::tuple_element_t<i, translations>;
 
             constexpr auto this_ec = boost::mp11::mp_front<entry_type>::value;
             using this_msg = boost::mp11::mp_back<entry_type>;
 
-            if (this_ec == e.ec()) {
-                throw parse_exception{utility::exception_formatter<this_msg>{}, e.tokens()};
+            if (!result && (this_ec == e.ec())) {
+                result.emplace(utility::exception_formatter<this_msg>{}, e.tokens());
             }
         });
+        if (result) {
+            return std::move(*result);
+        }
 
         const auto ec = static_cast<std::underlying_type_t<error_code>>(e.ec());
 
         // We use boost::lexical_cast here instead of std::to_string as arg_router::string may have
         // a non-std::allocator allocator type
         // NOLINTNEXTLINE(boost-use-to-string)
-        throw parse_exception{"Untranslated error code (" + boost::lexical_cast<string>(ec) + ")",
-                              e.tokens()};
+        return parse_exception{"Untranslated error code (" + boost::lexical_cast<string>(ec) + ")",
+                               e.tokens()};
+    }
+
+    /** Translates the error code in @a e and re-throws as an parse_exception.
+     *
+     * @param e Exception to translate
+     * @exception parse_exception
+     */
+    [[noreturn]] static void translate_exception(const multi_lang_exception& e)
+    {
+        throw translate(e);
     }
 };
 
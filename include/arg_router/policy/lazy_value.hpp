@@ -0,0 +1,34 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "arg_router/policy/policy.hpp"
+#include "arg_router/utility/lazy.hpp"
+
+namespace arg_router::policy
+{
+/** Defers the conversion and validation of the owning node's value until it is first accessed.
+ *
+ * Without this policy an argument's tokens are converted to its value type, and then validated
+ * (e.g. by policy::min_max_value_t), as part of the parse.  With it, the node's value type becomes
+ * utility::lazy, which holds the tokens and performs the conversion and validation on the first
+ * call to utility::lazy::get().  This is useful for values that are expensive to convert but that
+ * are rarely used by the router.
+ *
+ * The tokens refer to the strings passed to the parse call, and the converter refers to the
+ * owning node, so both must outlive the lazy value.
+ * @note Only supported by nodes derived from multi_arg_base_t (e.g. arg_t)
+ */
+template <typename = void>  // This is needed due so it can be used in
+struct lazy_value_t {       // template template parameters
+};
+
+/** Constant variable helper. */
+constexpr auto lazy_value = lazy_value_t<>{};
+
+template <>
+struct is_policy<lazy_value_t<>> : std::true_type {
+};
+}  // namespace arg_router::policy
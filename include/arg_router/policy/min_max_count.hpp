@@ -153,6 +153,10 @@ constexpr auto fixed_count =
 template <typename MinType, typename MaxType>
 struct is_policy<min_max_count_t<MinType, MaxType>> : std::true_type {
 };
+
+template <typename MinType, typename MaxType>
+struct supports_name_dispatch<min_max_count_t<MinType, MaxType>> : std::true_type {
+};
 }  // namespace policy
 
 /** Provides a tree_node type with an unbounded policy::min_max_count_t if a compatible one is not
@@ -77,6 +77,27 @@ struct has_pre_parse_phase_method {
 template <typename T>
 constexpr static bool has_pre_parse_phase_method_v = has_pre_parse_phase_method<T>::value;
 
+/** Evaluates to true if the <TT>pre_parse_phase</TT> method of @a T cannot cause its owning node
+ * to accept a leading (label) token that does not match one of the node's names.
+ *
+ * A short form token is also considered a match if its first character matches the node's short
+ * name, as policy::short_form_expander_t will split it.  If all of a named node's pre-parse phase
+ * policies are marked with this, then the owning mode can skip the node entirely when the names
+ * don't match (see parsing::name_dispatch_table).  Policies must opt in by specialising this, as
+ * assuming it would break policies that rewrite the label token like policy::value_separator_t.
+ * @tparam T Policy type to test
+ */
+template <typename T>
+struct supports_name_dispatch : std::false_type {
+};
+
+/** Helper variable for supports_name_dispatch.
+ *
+ * @tparam T Policy type to test
+ */
+template <typename T>
+constexpr auto supports_name_dispatch_v = supports_name_dispatch<T>::value;
+
 /** Determine if a policy has a <TT>parse_phase</TT> method.
  *
  * @tparam T Policy type to query
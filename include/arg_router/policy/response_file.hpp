@@ -0,0 +1,137 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "arg_router/parsing/shell_tokenizer.hpp"
+#include "arg_router/parsing/token_list.hpp"
+#include "arg_router/policy/policy.hpp"
+#include "arg_router/utility/compile_time_string.hpp"
+#include "arg_router/utility/mapped_file.hpp"
+
+#include <algorithm>
+
+namespace arg_router::policy
+{
+/** Allows the root to read tokens from response files.
+ *
+ * Any token that starts with the prefix (normally <TT>\@</TT>) is replaced by the tokens read from
+ * the file named by the rest of it, e.g. <TT>\@args.txt</TT>.  This gets around the operating
+ * system's limit on the command line length.
+ *
+ * The file is memory-mapped and tokenised in place, so the tokens view the mapping rather than
+ * copies of it.  The mapping is copy-on-write, so the file is not modified by the removal of any
+ * quotes or escapes.  The mappings are kept alive until routing has completed.
+ *
+ * If the file contains a NUL character then it is split on NULs (e.g. the output of
+ * <TT>find -print0</TT>), otherwise it is split using parsing::shell_split_in_place(span<char>,
+ * Fn&&).  Tokens read from a response file are not themselves checked for response files.
+ *
+ * If using C++17 then use the template variable helper with the <TT>S_</TT> macro or char; for
+ * C++20 and higher, use the char variable helper or the constructor directly with a compile-time
+ * string literal:
+ * @code
+ * constexpr auto a = ar::policy::response_file<'@'>;
+ * constexpr auto b = ar::policy::response_file_utf8<S_("@")>;
+ * constexpr auto c = ar::policy::response_file_t{"@"_S};
+ * @endcode
+ * @tparam S Compile-time string
+ */
+template <typename S>
+class response_file_t
+{
+    static_assert(!S::empty(), "Response file prefix must not be empty");
+
+public:
+    /** String type. */
+    using string_type = S;
+
+    /** Constructor.
+     *
+     * @param str String instance
+     */
+    constexpr explicit response_file_t([[maybe_unused]] S str = {}) noexcept {}
+
+    /** Returns the prefix that marks a token as a response file.
+     *
+     * @return Prefix
+     */
+    [[nodiscard]] constexpr static std::string_view response_file_prefix() noexcept
+    {
+        return S::get();
+    }
+
+    /** Replaces each response file token in @a tokens with the tokens read from the file.
+     *
+     * @param tokens Unprocessed tokens
+     * @return The file mappings, these must outlive @a tokens
+     * @exception multi_lang_exception Thrown if a file cannot be read or has an unterminated quote
+     */
+    [[nodiscard]] static vector<utility::mapped_file> expand_response_files(
+        parsing::token_list& tokens)
+    {
+        auto files = vector<utility::mapped_file>{};
+        if (std::none_of(tokens.begin(), tokens.end(), is_response_file)) {
+            return files;
+        }
+
+        auto expanded = vector<parsing::token_type>{};
+        expanded.reserve(tokens.size());
+        for (const auto& token : tokens) {
+            if (!is_response_file(token)) {
+                expanded.push_back(token);
+                continue;
+            }
+
+            auto file = utility::mapped_file::open(
+                string{token.name.substr(response_file_prefix().size())});
+            if (!file) {
+                throw multi_lang_exception{error_code::cannot_read_response_file, token};
+            }
+
+            const auto add_token = [&](std::string_view name) {
+                expanded.push_back(parsing::classify(name));
+            };
+            const auto data = file->data();
+            if (std::find(data.begin(), data.end(), '\0') != data.end()) {
+                parsing::nul_split(data, add_token);
+            } else {
+                parsing::shell_split_in_place(data, add_token);
+            }
+
+            // Moving the mapping does not move the mapped memory, so the tokens remain valid
+            files.push_back(std::move(*file));
+        }
+
+        tokens = parsing::token_list{std::move(expanded)};
+        return files;
+    }
+
+private:
+    [[nodiscard]] static bool is_response_file(const parsing::token_type& token) noexcept
+    {
+        return (token.prefix == parsing::prefix_type::none) &&
+               (token.name.size() > response_file_prefix().size()) &&
+               (token.name.substr(0, response_file_prefix().size()) == response_file_prefix());
+    }
+};
+
+/** Constant variable helper.
+ *
+ * @tparam S Prefix character
+ */
+template <char S = '@'>
+constexpr auto response_file = response_file_t<AR_STRING(S)>{};
+
+/** Constant variable helper that supports UTF-8 code points.
+ *
+ * @tparam S Compile-time string
+ */
+template <typename S>
+constexpr auto response_file_utf8 = response_file_t<S>{};
+
+template <typename S>
+struct is_policy<response_file_t<S>> : std::true_type {
+};
+}  // namespace arg_router::policy
@@ -73,6 +73,10 @@ template <typename T>
 struct is_policy<runtime_enable<T>> : std::true_type {
 };
 
+template <typename T>
+struct supports_name_dispatch<runtime_enable<T>> : std::true_type {
+};
+
 template <typename T>
 class runtime_enable_required : public runtime_enable<T>
 {
@@ -124,4 +128,8 @@ private:
 template <typename T>
 struct is_policy<runtime_enable_required<T>> : std::true_type {
 };
+
+template <typename T>
+struct supports_name_dispatch<runtime_enable_required<T>> : std::true_type {
+};
 }  // namespace arg_router::policy
@@ -6,13 +6,72 @@
 
 #include "arg_router/parsing/parse_target.hpp"
 #include "arg_router/parsing/parsing.hpp"
+#include "arg_router/parsing/unknown_argument_handling.hpp"
 #include "arg_router/policy/policy.hpp"
 #include "arg_router/traits.hpp"
 #include "arg_router/utility/compile_time_optional.hpp"
 #include "arg_router/utility/utf8.hpp"
 
+#include <algorithm>
+#include <array>
+
 namespace arg_router::policy
 {
+namespace detail
+{
+template <typename Node, typename = void>
+struct short_form_subtree {
+    using type = boost::mp11::mp_list<Node>;
+};
+
+template <typename Node>
+struct short_form_subtree<Node, std::void_t<typename Node::children_type>> {
+    template <typename Child>
+    using fn = typename short_form_subtree<Child>::type;
+
+    using type = boost::mp11::mp_push_front<
+        boost::mp11::mp_apply<boost::mp11::mp_append,
+                              boost::mp11::mp_transform<fn, typename Node::children_type>>,
+        Node>;
+};
+
+template <typename Nodes>
+struct short_name_set;
+
+template <typename... Nodes>
+struct short_name_set<boost::mp11::mp_list<Nodes...>> {
+private:
+    [[nodiscard]] constexpr static auto build() noexcept
+    {
+        auto names = std::array<std::string_view,
+                                (std::size_t{traits::has_short_name_method_v<Nodes>} + ... + 0)>{};
+        [[maybe_unused]] auto pos = std::size_t{0};
+        (
+            [&]() {
+                if constexpr (traits::has_short_name_method_v<Nodes>) {
+                    names[pos++] = Nodes::short_name();
+                }
+            }(),
+            ...);
+
+        // Insertion sort, as the std algorithms are not constexpr in C++17
+        for (auto i = std::size_t{1}; i < names.size(); ++i) {
+            const auto value = names[i];
+            auto j = i;
+            for (; (j > 0) && (value < names[j - 1]); --j) {
+                names[j] = names[j - 1];
+            }
+            names[j] = value;
+        }
+
+        return names;
+    }
+
+public:
+    constexpr static auto value = build();
+};
+}  // namespace detail
+
 /** Policy implementing a pre-parse phase that expands a collapsed short-form raw token into
  * multiple parsing::token_type instances.
  *
@@ -29,9 +88,16 @@ public:
 
     /** Performs the expansion in the pre-parse phase.
      *
-     * Checks if the token's first character matches the owning node's short name.  If there isn't a
-     * match or the owner does not have short name policy then it just returns false.  Otherwise all
-     * the characters in the token are converted into short form tokens, added to @a tokens.
+     * If the front token is a short form token with more than one character, then it is split so
+     * that its first character is kept as the front token and the rest are converted into short
+     * form tokens, added to @a tokens after it.  Any other token is left untouched.  This policy
+     * does not check that the first character is the owning node's short name, that is done by the
+     * owner itself after the pre-parse phase policies have run.
+     *
+     * If the owner has a parent, then each character is first checked against the short names
+     * under that parent.  A character that no node could accept means the expansion cannot succeed,
+     * so an unknown argument error is returned for it instead of creating tokens that would fail to
+     * match anyway.
      *
      * @note If a short-form expander is used, the long and short prefixes must be different
      *
@@ -42,8 +108,9 @@ public:
      * is no non-root parent
      * @param target Pre-parse generated target
      * @param parents Parent node instances
-     * @return Always returns true because if the token doesn't match the short form name, the node
-     * may have a long form one that does.  No exception is stored in the return value
+     * @return Always returns valid_node unless a character is unknown, because if the token doesn't
+     * match the short form name the node may have a long form one that does.  An unknown
+     * character's error is returned
      */
     template <typename ProcessedTarget, typename... Parents>
     [[nodiscard]] parsing::pre_parse_result pre_parse_phase(
@@ -77,7 +144,7 @@ public:
         if (first_token.prefix == parsing::prefix_type::none) {
             // The token has _probably_ not been processed yet, so try to convert to short form
             const auto& owner = algorithm::pack_element<0>(parents...);
-            const auto tt = parsing::get_token_type(owner, first_token.name);
+            const auto tt = parsing::get_token_type(owner, first_token);
             if (tt.prefix != parsing::prefix_type::short_) {
                 return parsing::pre_parse_action::valid_node;
             }
@@ -92,22 +159,39 @@ public:
             return parsing::pre_parse_action::valid_node;
         }
 
-        // Move the token to the processed container
-        tokens.transfer(first);
-
-        // Insert the extra flags at the front of the unprocessed section, so they will be processed
-        // independently
-        tokens.unprocessed().reserve(tokens.unprocessed().size() + first_token.name.size() - 1);
-        auto it = tokens.unprocessed().begin();
-
-        // Skip past the first grapheme cluster as we'll re-use the existing short form token for
-        // that
+        // Collect the extra flags so they can be inserted in one go, skipping past the first
+        // grapheme cluster as we'll re-use the existing short form token for that
+        auto expanded = vector<parsing::token_type>{};
+        expanded.reserve(utility::utf8::count(first_token.name) - 1);
         for (auto gc_it = ++utility::utf8::iterator{first_token.name};
              gc_it != utility::utf8::iterator{};
-             ++gc_it, ++it) {
-            it = tokens.unprocessed().insert(it, {parsing::prefix_type::short_, *gc_it});
+             ++gc_it) {
+            const auto name = *gc_it;
+            if constexpr (sizeof...(Parents) > 1) {
+                using parent_type = boost::mp11::mp_at_c<std::tuple<Parents...>, 1>;
+                constexpr auto& short_names = detail::short_name_set<
+                    typename detail::short_form_subtree<parent_type>::type>::value;
+
+                if (!std::binary_search(short_names.begin(), short_names.end(), name)) {
+                    // The owner only returns a pre-parse phase error once the front token has
+                    // matched its name, so the first token still has to be shrunk to its first
+                    // character otherwise the owner would skip the token and drop the error
+                    tokens.transfer(first);
+                    first.set({parsing::prefix_type::short_,
+                               *utility::utf8::iterator{first_token.name}});
+                    return parsing::unknown_argument_error(algorithm::pack_element<1>(parents...),
+                                                           {parsing::prefix_type::short_, name});
+                }
+            }
+
+            expanded.emplace_back(parsing::prefix_type::short_, name);
         }
 
+        // Move the token to the processed container, and insert the extra flags at the front of
+        // the unprocessed section, so they will be processed independently
+        tokens.transfer(first);
+        tokens.insert_unprocessed(0, expanded.begin(), expanded.end());
+
         // Shrink the first to a single grapheme cluster
         first.set({parsing::prefix_type::short_, *utility::utf8::iterator{first_token.name}});
 
@@ -121,4 +205,8 @@ constexpr auto short_form_expander = short_form_expander_t<>{};
 template <>
 struct is_policy<short_form_expander_t<>> : std::true_type {
 };
+
+template <>
+struct supports_name_dispatch<short_form_expander_t<>> : std::true_type {
+};
 }  // namespace arg_router::policy
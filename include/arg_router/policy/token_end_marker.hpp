@@ -110,4 +110,8 @@ constexpr auto token_end_marker = token_end_marker_t<S>{};
 template <typename S>
 struct is_policy<token_end_marker_t<S>> : std::true_type {
 };
+
+template <typename S>
+struct supports_name_dispatch<token_end_marker_t<S>> : std::true_type {
+};
 }  // namespace arg_router::policy
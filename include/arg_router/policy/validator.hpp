@@ -14,9 +14,12 @@
 #include "arg_router/mode.hpp"
 #include "arg_router/multi_arg.hpp"
 #include "arg_router/policy/alias.hpp"
+#include "arg_router/policy/bind_to.hpp"
+#include "arg_router/policy/compiled_grammar.hpp"
 #include "arg_router/policy/default_value.hpp"
 #include "arg_router/policy/dependent.hpp"
 #include "arg_router/policy/display_name.hpp"
+#include "arg_router/policy/lazy_value.hpp"
 #include "arg_router/policy/long_name.hpp"
 #include "arg_router/policy/none_name.hpp"
 #include "arg_router/policy/required.hpp"
@@ -645,6 +648,10 @@ constexpr auto default_validator = validator<
     rule_q<common_rules::despecialised_any_of_rule<policy::router>,
            despecialised_unique_in_owner,
            parent_types<parent_index_pair_type<0, mode_t>, parent_index_pair_type<1, root_t>>>,
+    // Bind to
+    rule_q<common_rules::despecialised_any_of_rule<policy::bind_to_t>,
+           despecialised_unique_in_owner,
+           parent_types<parent_index_pair_type<0, mode_t>>>,
     // Exception translator
     rule_q<common_rules::despecialised_any_of_rule<policy::exception_translator_t>,
            despecialised_unique_in_owner,
@@ -656,7 +663,8 @@ constexpr auto default_validator = validator<
     // Tree nodes
     // Flag
     rule_q<common_rules::despecialised_any_of_rule<flag_t>,
-           must_not_have_policies<policy::multi_stage_value,
+           must_not_have_policies<policy::lazy_value_t,
+                                  policy::multi_stage_value,
                                   policy::no_result_value,
                                   policy::required_t,
                                   policy::validation::validator>>,
@@ -677,7 +685,8 @@ constexpr auto default_validator = validator<
                                   policy::validation::validator>>,
     // Counting flag
     rule_q<common_rules::despecialised_any_of_rule<counting_flag_t>,
-           must_not_have_policies<policy::no_result_value,
+           must_not_have_policies<policy::lazy_value_t,
+                                  policy::no_result_value,
                                   policy::required_t,
                                   policy::validation::validator>>,
     // Positional arg
@@ -707,7 +716,8 @@ constexpr auto default_validator = validator<
                                   policy::required_t,
                                   policy::runtime_enable_required,
                                   policy::alias_t,
-                                  policy::dependent_t>,
+                                  policy::dependent_t,
+                                  policy::compiled_grammar_t>,
            node_types_must_be_at_end<positional_arg_t>,
            list_like_nodes_must_have_fixed_count_if_not_at_end,
            parent_types<parent_index_pair_type<0, root_t>, parent_index_pair_type<0, mode_t>>>,
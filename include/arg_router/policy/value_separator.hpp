@@ -100,7 +100,7 @@ public:
             // need to throw as the user has just forgotten the separator and needs to be told
             auto processed_token = first_token;
             if (first_token.prefix == parsing::prefix_type::none) {
-                processed_token = parsing::get_token_type(first_token.name);
+                processed_token = parsing::get_token_type(first_token);
             }
             if (parsing::match<owner_type>(processed_token)) {
                 return multi_lang_exception{error_code::missing_value_separator,
@@ -41,7 +41,7 @@ public:
     using typename parent_type::policies_type;
 
     /** Argument value type. */
-    using value_type = T;
+    using value_type = typename parent_type::value_type;
 
     /** Help data type. */
     template <bool Flatten>
@@ -74,7 +74,7 @@ public:
     }
 
     template <typename Validator, bool HasTarget, typename... Parents>
-    [[nodiscard]] std::optional<parsing::parse_target> pre_parse(
+    [[nodiscard]] parsing::pre_parse_target_result pre_parse(
         parsing::pre_parse_data<Validator, HasTarget> pre_parse_data,
         const Parents&... parents) const
     {
@@ -4,12 +4,20 @@
 
 #pragma once
 
+#include "arg_router/parse_session.hpp"
+#include "arg_router/parsing/name_dispatch_table.hpp"
+#include "arg_router/parsing/shell_tokenizer.hpp"
 #include "arg_router/parsing/unknown_argument_handling.hpp"
+#include "arg_router/policy/compiled_grammar.hpp"
 #include "arg_router/policy/exception_translator.hpp"
 #include "arg_router/policy/flatten_help.hpp"
 #include "arg_router/policy/no_result_value.hpp"
+#include "arg_router/policy/response_file.hpp"
 #include "arg_router/tree_node.hpp"
+#include "arg_router/utility/result.hpp"
 
+#include <iterator>
+#include <memory_resource>
 #include <utility>
 #include <variant>
 
@@ -55,6 +63,9 @@ class root_t : public detail::add_missing_exception_translator<Params...>::type
 {
     using parent_type = typename detail::add_missing_exception_translator<Params...>::type;
 
+    template <typename>
+    friend class parse_session;
+
 public:
     using typename parent_type::policies_type;
     using typename parent_type::children_type;
@@ -96,6 +107,8 @@ private:
     static_assert(boost::mp11::mp_all_of<children_type, router_checker>::value,
                   "All root children must have routers, unless they have no value");
 
+    using dispatch_table_type = parsing::name_dispatch_table<children_type>;
+
 public:
     /** Validator type. */
     // Initially I wanted the default_validator to be used if one isn't user specified, but you get
@@ -146,37 +159,7 @@ public:
      */
     void parse(vector<parsing::token_type> args) const
     {
-        try {
-            // Take a copy of the front token for the error messages
-            const auto front_token = args.empty() ?  //
-                                         parsing::token_type{parsing::prefix_type::none, ""} :
-                                         args.front();
-
-            // Find a matching child
-            auto match = std::optional<parsing::parse_target>{};
-            utility::tuple_iterator(
-                [&](auto /*i*/, const auto& child) {
-                    // Skip any remaining children if one has been found
-                    if (!match && (match = child.pre_parse(parsing::pre_parse_data{args}, *this))) {
-                        if (!args.empty()) {
-                            throw multi_lang_exception{error_code::unhandled_arguments, args};
-                        }
-                        (*match)();
-                    }
-                },
-                this->children());
-            if (!match) {
-                if (front_token.name.empty()) {
-                    throw multi_lang_exception{error_code::no_arguments_passed};
-                }
-                parsing::unknown_argument_exception(*this, front_token);
-            }
-        } catch (multi_lang_exception& e) {
-            // Convert the error code exception to a parse_exception.  This method will always be
-            // present because even if an exception_translator-like policy is not specified by the
-            // user, a default en_GB one is added
-            this->translate_exception(e);
-        }
+        try_parse(std::move(args)).throw_exception();
     }
 
     /** Parse the <TT>std::string_view</TT> convertible elements between @a begin and @a end.
@@ -190,13 +173,7 @@ public:
     template <typename Iter, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Iter>, int>>>
     void parse(Iter begin, Iter end) const
     {
-        auto args = vector<parsing::token_type>{};
-        for (; begin != end; ++begin) {
-            args.emplace_back(parsing::prefix_type::none, *begin);
-        }
-        args.shrink_to_fit();
-
-        parse(std::move(args));
+        try_parse(std::move(begin), std::move(end)).throw_exception();
     }
 
     /** Parse all <TT>std::string_view</TT> convertible elements in @a c.
@@ -212,10 +189,7 @@ public:
                   !std::is_same_v<std::decay_t<Container>, vector<parsing::token_type>>>>
     void parse(const Container& c) const
     {
-        using std::begin;
-        using std::end;
-
-        parse(std::begin(c), std::end(c));
+        try_parse(c).throw_exception();
     }
 
     /** Parse the raw command line arguments.
@@ -225,10 +199,350 @@ public:
      * @param argv Array of char pointers to the command line tokens
      * @exception parse_exception Thrown if parsing has failed
      */
-    void parse(int argc, char** argv) const
+    void parse(int argc, char** argv) const { try_parse(argc, argv).throw_exception(); }
+
+    /** Split a single command string into tokens and parse them.
+     *
+     * The string is split using POSIX shell-like quoting and escaping rules, see
+     * parsing::shell_split(std::string_view, string&, Fn&&).  The first token is @em not expected
+     * to be the executable name.
+     * @note Tokens without quotes or escapes are not copied, so @a command_line must out live the
+     * parse process
+     * @param command_line Command string
+     * @exception parse_exception Thrown if parsing has failed
+     */
+    void parse_command_line(std::string_view command_line) const
+    {
+        try_parse_command_line(command_line).throw_exception();
+    }
+
+    /** Parse the unprocessed token_types, allocating from @a resource.
+     *
+     * All memory allocated by arg_router during the parse comes from @a resource, so a
+     * <TT>std::pmr::monotonic_buffer_resource</TT> can be used to give each parse a fixed memory
+     * cost that is released in one shot.  This requires <TT>AR_ALLOCATOR</TT> to be
+     * utility::resource_allocator.
+     * @note @a resource must outlive any exception thrown from this call
+     * @param args Vector of tokens
+     * @param resource Memory resource to allocate from
+     * @exception parse_exception Thrown if parsing has failed
+     */
+    void parse(vector<parsing::token_type> args, std::pmr::memory_resource& resource) const
+    {
+        try_parse(std::move(args), resource).throw_exception();
+    }
+
+    /** Parse the <TT>std::string_view</TT> convertible elements between @a begin and @a end,
+     * allocating from @a resource.
+     *
+     * @note The strings must out live the parse process as they are not copied
+     * @note @a resource must outlive any exception thrown from this call
+     * @tparam Iter Iterator type to <TT>std::string_view</TT> convertible elements
+     * @param begin Iterator to the first element
+     * @param end Iterator to the one-past-the-end element
+     * @param resource Memory resource to allocate from
+     * @exception parse_exception Thrown if parsing has failed
+     */
+    template <typename Iter, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Iter>, int>>>
+    void parse(Iter begin, Iter end, std::pmr::memory_resource& resource) const
+    {
+        try_parse(std::move(begin), std::move(end), resource).throw_exception();
+    }
+
+    /** Parse all <TT>std::string_view</TT> convertible elements in @a c, allocating from
+     * @a resource.
+     *
+     * @note @a resource must outlive any exception thrown from this call
+     * @tparam Container
+     * @param c Elements to parse
+     * @param resource Memory resource to allocate from
+     * @exception parse_exception Thrown if parsing has failed
+     */
+    template <typename Container,
+              typename = std::enable_if_t<
+                  !std::is_same_v<std::decay_t<Container>, vector<parsing::token_type>>>>
+    void parse(const Container& c, std::pmr::memory_resource& resource) const
+    {
+        try_parse(c, resource).throw_exception();
+    }
+
+    /** Parse the raw command line arguments, allocating from @a resource.
+     *
+     * @note @a resource must outlive any exception thrown from this call
+     * @param argc Number of arguments
+     * @param argv Array of char pointers to the command line tokens
+     * @param resource Memory resource to allocate from
+     * @exception parse_exception Thrown if parsing has failed
+     */
+    void parse(int argc, char** argv, std::pmr::memory_resource& resource) const
+    {
+        try_parse(argc, argv, resource).throw_exception();
+    }
+
+    /** Split a single command string into tokens and parse them, allocating from @a resource.
+     *
+     * @note Tokens without quotes or escapes are not copied, so @a command_line must out live the
+     * parse process
+     * @note @a resource must outlive any exception thrown from this call
+     * @param command_line Command string
+     * @param resource Memory resource to allocate from
+     * @exception parse_exception Thrown if parsing has failed
+     */
+    void parse_command_line(std::string_view command_line,
+                            std::pmr::memory_resource& resource) const
+    {
+        try_parse_command_line(command_line, resource).throw_exception();
+    }
+
+    /** Equivalent to parse(vector<parsing::token_type>), but returns the error rather than
+     * throwing it.
+     *
+     * Errors detected by the root (unknown, unhandled, or missing arguments) are returned without
+     * being thrown at all, and errors raised by the nodes are translated without being re-thrown.
+     * @param args Vector of tokens
+     * @return Empty result on success, otherwise the parse_exception describing the error
+     */
+    [[nodiscard]] utility::result<void, parse_exception> try_parse(
+        vector<parsing::token_type> args) const
+    {
+        auto tokens = parsing::token_list{std::move(args)};
+        return try_parse_impl(tokens);
+    }
+
+    /** Equivalent to parse(Iter, Iter), but returns the error rather than throwing it.
+     *
+     * @note The strings must out live the parse process as they are not copied.
+     * @tparam Iter Iterator type to <TT>std::string_view</TT> convertible elements
+     * @param begin Iterator to the first element
+     * @param end Iterator to the one-past-the-end element
+     * @return Empty result on success, otherwise the parse_exception describing the error
+     */
+    template <typename Iter, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Iter>, int>>>
+    [[nodiscard]] utility::result<void, parse_exception> try_parse(Iter begin, Iter end) const
+    {
+        // Size the token buffer once where the input length is known (e.g. argc), rather than
+        // growing it per token and trimming it afterwards
+        auto args = vector<parsing::token_type>{};
+        using iterator_category = typename std::iterator_traits<Iter>::iterator_category;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, iterator_category>) {
+            args.reserve(static_cast<std::size_t>(std::distance(begin, end)));
+        }
+        for (; begin != end; ++begin) {
+            args.push_back(parsing::classify(*begin));
+        }
+
+        return try_parse(std::move(args));
+    }
+
+    /** Equivalent to parse(const Container&), but returns the error rather than throwing it.
+     *
+     * @tparam Container
+     * @param c Elements to parse
+     * @return Empty result on success, otherwise the parse_exception describing the error
+     */
+    template <typename Container,
+              typename = std::enable_if_t<
+                  !std::is_same_v<std::decay_t<Container>, vector<parsing::token_type>>>>
+    [[nodiscard]] utility::result<void, parse_exception> try_parse(const Container& c) const
+    {
+        using std::begin;
+        using std::end;
+
+        return try_parse(std::begin(c), std::end(c));
+    }
+
+    /** Equivalent to parse(int, char**), but returns the error rather than throwing it.
+     *
+     * @param argc Number of arguments
+     * @param argv Array of char pointers to the command line tokens
+     * @return Empty result on success, otherwise the parse_exception describing the error
+     */
+    [[nodiscard]] utility::result<void, parse_exception> try_parse(int argc, char** argv) const
     {
         // Skip the program name
-        parse(&argv[1], &argv[argc]);
+        return try_parse(&argv[1], &argv[argc]);
+    }
+
+    /** Equivalent to parse_command_line(std::string_view), but returns the error rather than
+     * throwing it.
+     *
+     * @param command_line Command string
+     * @return Empty result on success, otherwise the parse_exception describing the error
+     */
+    [[nodiscard]] utility::result<void, parse_exception> try_parse_command_line(
+        std::string_view command_line) const
+    {
+        // Only tokens with quotes or escapes are copied, into an arena sized to the input once
+        auto arena = string{};
+        auto tokens = parsing::token_list{};
+        auto split = catch_errors([&]() -> utility::result<void, multi_lang_exception> {
+            parsing::shell_split(command_line, arena, [&](std::string_view token) {
+                tokens.push_back(parsing::classify(token));
+            });
+            return {};
+        });
+        if (split.has_error()) {
+            return split;
+        }
+
+        return try_parse_impl(tokens);
+    }
+
+    /** Equivalent to parse(vector<parsing::token_type>, std::pmr::memory_resource&), but returns
+     * the error rather than throwing it.
+     *
+     * @note @a resource must outlive the returned result
+     * @param args Vector of tokens
+     * @param resource Memory resource to allocate from
+     * @return Empty result on success, otherwise the parse_exception describing the error
+     */
+    [[nodiscard]] utility::result<void, parse_exception> try_parse(
+        vector<parsing::token_type> args,
+        std::pmr::memory_resource& resource) const
+    {
+        return with_memory_resource(resource, [&]() { return try_parse(std::move(args)); });
+    }
+
+    /** Equivalent to parse(Iter, Iter, std::pmr::memory_resource&), but returns the error rather
+     * than throwing it.
+     *
+     * @note The strings must out live the parse process as they are not copied
+     * @note @a resource must outlive the returned result
+     * @tparam Iter Iterator type to <TT>std::string_view</TT> convertible elements
+     * @param begin Iterator to the first element
+     * @param end Iterator to the one-past-the-end element
+     * @param resource Memory resource to allocate from
+     * @return Empty result on success, otherwise the parse_exception describing the error
+     */
+    template <typename Iter, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Iter>, int>>>
+    [[nodiscard]] utility::result<void, parse_exception> try_parse(
+        Iter begin,
+        Iter end,
+        std::pmr::memory_resource& resource) const
+    {
+        return with_memory_resource(resource, [&]() { return try_parse(begin, end); });
+    }
+
+    /** Equivalent to parse(const Container&, std::pmr::memory_resource&), but returns the error
+     * rather than throwing it.
+     *
+     * @note @a resource must outlive the returned result
+     * @tparam Container
+     * @param c Elements to parse
+     * @param resource Memory resource to allocate from
+     * @return Empty result on success, otherwise the parse_exception describing the error
+     */
+    template <typename Container,
+              typename = std::enable_if_t<
+                  !std::is_same_v<std::decay_t<Container>, vector<parsing::token_type>>>>
+    [[nodiscard]] utility::result<void, parse_exception> try_parse(
+        const Container& c,
+        std::pmr::memory_resource& resource) const
+    {
+        return with_memory_resource(resource, [&]() { return try_parse(c); });
+    }
+
+    /** Equivalent to parse(int, char**, std::pmr::memory_resource&), but returns the error rather
+     * than throwing it.
+     *
+     * @note @a resource must outlive the returned result
+     * @param argc Number of arguments
+     * @param argv Array of char pointers to the command line tokens
+     * @param resource Memory resource to allocate from
+     * @return Empty result on success, otherwise the parse_exception describing the error
+     */
+    [[nodiscard]] utility::result<void, parse_exception> try_parse(
+        int argc,
+        char** argv,
+        std::pmr::memory_resource& resource) const
+    {
+        return with_memory_resource(resource, [&]() { return try_parse(argc, argv); });
+    }
+
+    /** Equivalent to parse_command_line(std::string_view, std::pmr::memory_resource&), but
+     * returns the error rather than throwing it.
+     *
+     * @note @a resource must outlive the returned result
+     * @param command_line Command string
+     * @param resource Memory resource to allocate from
+     * @return Empty result on success, otherwise the parse_exception describing the error
+     */
+    [[nodiscard]] utility::result<void, parse_exception> try_parse_command_line(
+        std::string_view command_line,
+        std::pmr::memory_resource& resource) const
+    {
+        return with_memory_resource(resource,
+                                    [&]() { return try_parse_command_line(command_line); });
+    }
+
+    /** Parses and routes each command line in @a command_lines, collecting the error for each
+     * one rather than stopping at the first.
+     *
+     * Each command line is a range of <TT>std::string_view</TT> convertible elements, as used by
+     * parse(const Container&).  The token buffer is reused between command lines, so this is
+     * cheaper than calling parse(const Container&) in a loop.
+     *
+     * @a executor is called once as <TT>executor(count, work)</TT>, where @a count is the number of
+     * command lines.  It must call <TT>work(first, last)</TT> over ranges of indices that cover
+     * [0, @a count) exactly once, and only return once they have all completed.  The ranges can be
+     * processed concurrently (e.g. on a thread pool), in which case the routers will be called
+     * concurrently too.
+     * @code
+     * const auto results = r.parse_batch(command_lines, [&](std::size_t count, const auto& work) {
+     *     // Split [0, count) up between the threads...
+     * });
+     * @endcode
+     * @note The strings must out live the parse process as they are not copied
+     * @tparam Range Forward range of command lines
+     * @tparam Executor Callable that distributes the work
+     * @param command_lines Command lines to parse, none are expected to start with the executable
+     * name
+     * @param executor Work distributor
+     * @return A result for each command line, in the same order as @a command_lines
+     */
+    template <typename Range, typename Executor>
+    [[nodiscard]] vector<utility::result<void, parse_exception>> parse_batch(
+        const Range& command_lines,
+        Executor&& executor) const
+    {
+        using std::begin;
+        using std::end;
+
+        const auto count =
+            static_cast<std::size_t>(std::distance(begin(command_lines), end(command_lines)));
+        auto results = vector<utility::result<void, parse_exception>>(count);
+
+        // Each range has its own token buffer, and each writes to a different part of results
+        const auto work = [&](std::size_t first, std::size_t last) {
+            auto tokens = parsing::token_list{};
+            auto it = std::next(begin(command_lines), first);
+            for (auto i = first; i < last; ++i, ++it) {
+                tokens.clear();
+                for (const auto& arg : *it) {
+                    tokens.push_back(parsing::classify(arg));
+                }
+
+                results[i] = try_parse_impl(tokens);
+            }
+        };
+        std::forward<Executor>(executor)(count, work);
+
+        return results;
+    }
+
+    /** Overload that parses each command line in turn on the calling thread.
+     *
+     * @tparam Range Forward range of command lines
+     * @param command_lines Command lines to parse, none are expected to start with the executable
+     * name
+     * @return A result for each command line, in the same order as @a command_lines
+     */
+    template <typename Range>
+    [[nodiscard]] vector<utility::result<void, parse_exception>> parse_batch(
+        const Range& command_lines) const
+    {
+        return parse_batch(command_lines,
+                           [](std::size_t count, const auto& work) { work(0, count); });
     }
 
     /** Generates a root-level help string and writes it into @a stream.
@@ -282,6 +596,178 @@ public:
 
         return stream.str();
     }
+
+private:
+    [[nodiscard]] utility::result<void, parse_exception> try_parse_impl(
+        parsing::token_list& tokens) const
+    {
+        return catch_errors([&]() -> utility::result<void, multi_lang_exception> {
+            // Tokens read from response files view the file mappings, so they are kept alive
+            // until routing has completed
+            [[maybe_unused]] const auto response_files = expand_response_files(tokens);
+            auto target = pre_parse_impl(tokens);
+            if (auto* t = target.get_if()) {
+                (*t)();
+                return {};
+            }
+            return *target.get_error_if();
+        });
+    }
+
+    // The result is false if the tokens are acceptable so far, but a node is still waiting for
+    // its value tokens
+    [[nodiscard]] utility::result<bool, parse_exception> try_pre_parse_impl(
+        parsing::token_list& tokens) const
+    {
+        auto complete = true;
+        auto result = catch_errors([&]() -> utility::result<void, multi_lang_exception> {
+            [[maybe_unused]] const auto response_files = expand_response_files(tokens);
+            auto target = pre_parse_impl(tokens);
+            if (const auto* e = target.get_error_if()) {
+                // Unless the node has a token end marker, these are only returned when the tokens
+                // run out before the node's minimum value count is reached, which later tokens
+                // may satisfy
+                if ((e->ec() == error_code::minimum_count_not_reached) ||
+                    (e->ec() == error_code::too_few_values_for_alias)) {
+                    complete = false;
+                    return {};
+                }
+                return *e;
+            }
+            return {};
+        });
+        if (auto* e = result.get_error_if()) {
+            return std::move(*e);
+        }
+
+        return complete;
+    }
+
+    [[nodiscard]] auto expand_response_files([[maybe_unused]] parsing::token_list& tokens) const
+    {
+        constexpr auto index =
+            algorithm::find_specialisation_v<policy::response_file_t, policies_type>;
+        if constexpr (index < std::tuple_size_v<policies_type>) {
+            using response_file_type = std::tuple_element_t<index, policies_type>;
+            return response_file_type::expand_response_files(tokens);
+        } else {
+            return std::tuple<>{};
+        }
+    }
+
+    [[nodiscard]] utility::result<parsing::parse_target, multi_lang_exception> pre_parse_impl(
+        parsing::token_list& tokens) const
+    {
+        // Classify each unprocessed token once, rather than have every node that tests it do it
+        for (auto& token : tokens) {
+            if ((token.prefix == parsing::prefix_type::none) && !token.classification) {
+                token = parsing::classify(token.name);
+            }
+        }
+
+        // Take a copy of the front token for the error messages
+        const auto front_token = tokens.empty() ?  //
+                                     parsing::token_type{parsing::prefix_type::none, ""} :
+                                     tokens.front();
+
+        auto result = parsing::pre_parse_target_result{std::nullopt};
+        auto selected = false;
+        if constexpr (policy::has_compiled_grammar_v<root_t>) {
+            // The mode is selected by walking the leading mode names through the compiled
+            // transition tables, falling back to trying the children if the front token does not
+            // name one
+            if (auto grammar_result = policy::compiled_grammar_t<>::pre_parse(tokens, *this)) {
+                result = std::move(*grammar_result);
+                selected = true;
+            }
+        }
+
+        if (!selected) {
+            // Named children (e.g. modes) are selected by looking up the front token in a
+            // compile-time table, so only the candidates and the unnamed children need trying
+            const auto candidates = tokens.empty() ?
+                                        typename dispatch_table_type::candidates_type{} :
+                                        dispatch_table_type::find(front_token);
+
+            // Find a matching child, skipping any remaining children once one has been found or
+            // has returned an error
+            utility::tuple_iterator(
+                [&]([[maybe_unused]] auto i, const auto& child) {
+                    if constexpr (dispatch_table_type::template is_dispatchable<i>) {
+                        if (!candidates[i]) {
+                            return;
+                        }
+                    }
+                    if (!result.has_error() && !*result.get_if()) {
+                        result = child.pre_parse(parsing::pre_parse_data{tokens}, *this);
+                    }
+                },
+                this->children());
+        }
+        if (const auto* e = result.get_error_if()) {
+            return *e;
+        }
+
+        auto& match = *result.get_if();
+        if (!match) {
+            if (front_token.name.empty()) {
+                return multi_lang_exception{error_code::no_arguments_passed};
+            }
+            return parsing::unknown_argument_error(*this, front_token);
+        }
+        if (!tokens.empty()) {
+            return multi_lang_exception{error_code::unhandled_arguments,
+                                        vector<parsing::token_type>{tokens.begin(), tokens.end()}};
+        }
+
+        return std::move(*match);
+    }
+
+    template <typename Fn>
+    [[nodiscard]] utility::result<void, parse_exception> catch_errors(Fn&& fn) const
+    {
+        try {
+            const auto result = std::forward<Fn>(fn)();
+            if (const auto* e = result.get_error_if()) {
+                return translate_error(*e);
+            }
+            return {};
+        } catch (multi_lang_exception& e) {
+            return translate_error(e);
+        }
+    }
+
+    [[nodiscard]] utility::result<void, parse_exception> translate_error(
+        const multi_lang_exception& e) const
+    {
+        // Convert the error code exception to a parse_exception.  One of these methods will
+        // always be present because even if an exception_translator-like policy is not specified
+        // by the user, a default en_GB one is added
+        if constexpr (traits::has_translate_method_v<parent_type>) {
+            return this->translate(e);
+        } else {
+            try {
+                this->translate_exception(e);
+            } catch (parse_exception& pe) {
+                return pe;
+            }
+
+            // The translator has chosen to suppress the error
+            return {};
+        }
+    }
+
+    template <typename Fn>
+    static decltype(auto) with_memory_resource(std::pmr::memory_resource& resource, Fn&& fn)
+    {
+        static_assert(std::is_same_v<config::allocator<std::decay_t<Fn>>,
+                                     utility::resource_allocator<std::decay_t<Fn>>>,
+                      "Per-parse memory resources require AR_ALLOCATOR to be "
+                      "arg_router::utility::resource_allocator");
+
+        const auto scope = utility::memory_resource_scope{resource};
+        return std::forward<Fn>(fn)();
+    }
 };
 
 /** Constructs a root_t with the given policies and children.
@@ -533,6 +533,25 @@ struct has_push_back_method {
 template <typename T>
 constexpr bool has_push_back_method_v = has_push_back_method<T>::value;
 
+/** Determine if a type has a <TT>reserve(typename T::size_type)</TT> method.
+ *
+ * @tparam T Type to query
+ */
+template <typename T>
+struct has_reserve_method {
+    template <typename U>
+    using type = decltype(std::declval<U&>().reserve(std::declval<typename U::size_type>()));
+
+    constexpr static bool value = boost::mp11::mp_valid<type, T>::value;
+};
+
+/** Helper variable for has_reserve_method.
+ *
+ * @tparam T Type to query
+ */
+template <typename T>
+constexpr bool has_reserve_method_v = has_reserve_method<T>::value;
+
 /** Determine if a type has a <TT>help_data_type</TT> nested type.
  *
  * @tparam T Type to query
@@ -683,6 +702,25 @@ struct has_translate_exception_method {
 template <typename T>
 constexpr static bool has_translate_exception_method_v = has_translate_exception_method<T>::value;
 
+/** Determine if a type has a <TT>translate</TT> method.
+ *
+ * @tparam T Type to query
+ */
+template <typename T>
+struct has_translate_method {
+    template <typename U>
+    using type = decltype(U::translate(std::declval<const multi_lang_exception&>()));
+
+    constexpr static bool value = boost::mp11::mp_valid<type, T>::value;
+};
+
+/** Helper variable for has_translate_method.
+ *
+ * @tparam T Type to query
+ */
+template <typename T>
+constexpr static bool has_translate_method_v = has_translate_method<T>::value;
+
 /** Determine if a type has a <TT>error_code_translations</TT> nested type.
  *
  * @tparam T Type to query
@@ -457,12 +457,11 @@ protected:
      * @param pre_parse_data Pre-parse data aggregate
      * @param node This node instance
      * @param parents Parent node instances
-     * @return Non-empty if the leading tokens in @a args are consumable by this node
-     * @exception multi_lang_exception Thrown if any of the policies' pre-parse implementations have
-     * returned an exception
+     * @return Non-empty target if the leading tokens in @a args are consumable by this node, or
+     * the error if any of the policies' pre-parse implementations (or the validator) returned one
      */
     template <typename Validator, bool HasTarget, typename Node, typename... Parents>
-    [[nodiscard]] std::optional<parsing::parse_target> pre_parse(
+    [[nodiscard]] parsing::pre_parse_target_result pre_parse(
         parsing::pre_parse_data<Validator, HasTarget> pre_parse_data,
         const Node& node,
         const Parents&... parents) const
@@ -545,14 +544,15 @@ private:
     }
 
     template <typename Validator, bool HasTarget, typename Node, typename... Parents>
-    [[nodiscard]] std::optional<parsing::parse_target> pre_parse_impl(
+    [[nodiscard]] parsing::pre_parse_target_result pre_parse_impl(
         parsing::pre_parse_data<Validator, HasTarget> pre_parse_data,
         const Node& node,
         const Parents&... parents) const
     {
-        auto result = vector<parsing::token_type>{};
-        auto tmp_args = pre_parse_data.args();
-        auto adapter = parsing::dynamic_token_adapter{result, tmp_args};
+        // The adapter does not modify the args until it is committed, so if this node rejects the
+        // tokens we can just drop it
+        auto result = parsing::token_buffer{};
+        auto adapter = parsing::dynamic_token_adapter{result, pre_parse_data.args()};
 
         // At this stage, the target is only for collecting sub-targets
         auto target = parsing::parse_target{node, parents...};
@@ -580,10 +580,10 @@ private:
         });
 
         // If we have a result and it is false, then exit early.  We need to wait until after name
-        // checking is (possibly) performed to throw an exception, otherwise a parse-stopping
-        // exception could be thrown when the target of the token isn't even this node
+        // checking is (possibly) performed to return an error, otherwise a parse-stopping error
+        // could be returned when the target of the token isn't even this node
         if (match == parsing::pre_parse_action::skip_node) {
-            return {};
+            return std::optional<parsing::parse_target>{};
         }
 
         if constexpr (is_named) {
@@ -592,36 +592,42 @@ private:
                 // If the node is named but there are no tokens, then take the first from args.
                 // If args is empty, then return false
                 if (result.empty()) {
-                    if (tmp_args.empty()) {
-                        return {};
+                    if (adapter.empty()) {
+                        return std::optional<parsing::parse_target>{};
                     }
-                    result.push_back(tmp_args.front());
-                    tmp_args.erase(tmp_args.begin());
+                    adapter.transfer(adapter.begin());
                 }
 
                 // The first token may not have been processed, so convert
                 auto& first_token = result.front();
                 if (first_token.prefix == parsing::prefix_type::none) {
-                    first_token = parsing::get_token_type(*this, first_token.name);
+                    first_token = parsing::get_token_type(*this, first_token);
                 }
 
                 // And then test it is correct unless we are skipping
                 if (!parsing::match<tree_node>(first_token)) {
-                    return {};
+                    return std::optional<parsing::parse_target>{};
                 }
             }
         }
 
         // Exit early if the caller doesn't want this node
-        if (!pre_parse_data.validator()(node, parents...)) {
-            return {};
+        const auto validation =
+            parsing::validation_result(pre_parse_data.validator()(node, parents...));
+        if (const auto* e = validation.get_error_if()) {
+            return *e;
+        }
+        if (validation == parsing::pre_parse_action::skip_node) {
+            return std::optional<parsing::parse_target>{};
         }
 
-        // If the policy checking returned an exception, now is the time to throw it
-        match.throw_exception();
+        // If the policy checking returned an exception, now is the time to return it
+        if (const auto* e = match.get_error_if()) {
+            return *e;
+        }
 
         // Update the unprocessed args
-        pre_parse_data.args() = tmp_args;
+        adapter.commit();
 
         // Update the target with the pre-parsed tokens.  Remove the label token if present
         if constexpr (is_named) {
@@ -631,7 +637,7 @@ private:
         }
         target.tokens(std::move(result));
 
-        return target;
+        return std::optional{std::move(target)};
     }
 
     template <typename ValueType, typename... Parents>
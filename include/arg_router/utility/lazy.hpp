@@ -0,0 +1,173 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "arg_router/config.hpp"
+#include "arg_router/parsing/token_type.hpp"
+
+#include <array>
+#include <optional>
+#include <utility>
+
+namespace arg_router::utility
+{
+/** A value that is only calculated when first accessed.
+ *
+ * This is the value type that nodes using policy::lazy_value_t pass to the router, it holds the
+ * value tokens and a converter function that is invoked on the first call to get() and the result
+ * cached for subsequent calls.
+ * @code
+ * policy::router{[](utility::lazy<std::regex> pattern) {
+ *     if (rare_condition) {
+ *         std::regex_match(input, pattern.get());  // Converted and validated here
+ *     }
+ * }}
+ * @endcode
+ *
+ * The converter is a plain function pointer with the owning node and its parents passed in as
+ * type-erased pointers (the same approach as parsing::parse_target), so creating a lazy value
+ * does not allocate beyond the token storage, which uses the configured allocator.  The pointers
+ * are held inline, so the owning node must be within config::max_tree_depth of the root and each
+ * copy or move of a lazy value copies them too.
+ *
+ * A moved-from instance behaves as if default constructed i.e. get() returns a default
+ * initialised value_type rather than converting the tokens.
+ * @note Not thread-safe, even when accessed via a const reference
+ * @tparam T Value type
+ */
+template <typename T>
+class lazy
+{
+public:
+    /** Value type. */
+    using value_type = T;
+
+    /** Type-erased node ancestry, the owning node is first followed by its parents in ascending
+     * ancestry order.
+     */
+    using ancestry_type = std::array<const void*, config::max_tree_depth>;
+
+    /** Converter function type. */
+    using converter_type = value_type (*)(const parsing::token_buffer&, const ancestry_type&);
+
+    /** Default constructor.
+     *
+     * The value is a default initialised value_type.
+     */
+    lazy() : value_{value_type{}} {}
+
+    /** Constructor from an already calculated value.
+     *
+     * @param value Value
+     */
+    // NOLINTNEXTLINE(google-explicit-constructor,hicpp-explicit-conversions)
+    lazy(value_type value) : value_{std::move(value)} {}
+
+    /** Constructor from a converter.
+     *
+     * @param converter Function that will calculate the value from @a tokens when first accessed
+     * @param tokens Value tokens
+     * @param ancestry Type-erased pointers to the owning node and its parents, they must outlive
+     * this instance
+     */
+    lazy(converter_type converter,
+         parsing::token_buffer tokens,
+         const ancestry_type& ancestry = {}) noexcept :
+        tokens_{std::move(tokens)}, ancestry_(ancestry), converter_{converter}
+    {
+    }
+
+    /** Copy constructor.
+     *
+     * @param other Instance to copy from
+     */
+    lazy(const lazy& other) = default;
+
+    /** Move constructor.
+     *
+     * @param other Instance to move from, it is left as if default constructed
+     */
+    lazy(lazy&& other) noexcept(std::is_nothrow_move_constructible_v<value_type>) :
+        tokens_{std::move(other.tokens_)},
+        ancestry_(other.ancestry_),
+        converter_{std::exchange(other.converter_, nullptr)},
+        value_{std::exchange(other.value_, std::nullopt)}
+    {
+    }
+
+    /** Copy assignment.
+     *
+     * @param other Instance to copy from
+     * @return Reference to this
+     */
+    lazy& operator=(const lazy& other) = default;
+
+    /** Move assignment.
+     *
+     * @param other Instance to move from, it is left as if default constructed
+     * @return Reference to this
+     */
+    lazy& operator=(lazy&& other) noexcept(std::is_nothrow_move_assignable_v<value_type>)
+    {
+        if (this != &other) {
+            tokens_ = std::move(other.tokens_);
+            ancestry_ = other.ancestry_;
+            converter_ = std::exchange(other.converter_, nullptr);
+            value_ = std::exchange(other.value_, std::nullopt);
+        }
+        return *this;
+    }
+
+    /** Destructor. */
+    ~lazy() = default;
+
+    /** Returns true if the value has been calculated.
+     *
+     * @return True if calculated
+     */
+    [[nodiscard]] bool has_value() const noexcept { return value_.has_value(); }
+
+    /** Returns the value, calculating it if this is the first access.
+     *
+     * If the converter throws then the exception is propagated, and the converter will be called
+     * again on the next access.
+     * @return Value reference
+     * @exception multi_lang_exception Thrown if conversion or validation failed
+     */
+    [[nodiscard]] const value_type& get() const
+    {
+        if (!value_) {
+            // No converter means that this instance has been moved from
+            if (!converter_) {
+                value_ = value_type{};
+            } else {
+                value_ = converter_(tokens_, ancestry_);
+                converter_ = nullptr;
+                tokens_.clear();
+            }
+        }
+        return *value_;
+    }
+
+    /** Dereference operator.
+     *
+     * Equivalent to get().
+     * @return Value reference
+     */
+    [[nodiscard]] const value_type& operator*() const { return get(); }
+
+    /** Structure dereference operator.
+     *
+     * @return Value pointer
+     */
+    [[nodiscard]] const value_type* operator->() const { return &get(); }
+
+private:
+    mutable parsing::token_buffer tokens_;
+    ancestry_type ancestry_{};
+    mutable converter_type converter_ = nullptr;
+    mutable std::optional<value_type> value_;
+};
+}  // namespace arg_router::utility
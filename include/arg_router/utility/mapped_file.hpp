@@ -0,0 +1,159 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "arg_router/basic_types.hpp"
+
+#include <optional>
+#include <utility>
+
+#if defined(__linux__) || defined(__APPLE__)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#elif _WIN32
+#    include "arg_router/utility/win_api.hpp"
+#endif
+
+namespace arg_router::utility
+{
+/** A private (copy-on-write) memory mapping of a file.
+ *
+ * The mapped bytes can be modified, but the changes are never written back to the file and only
+ * the modified pages are copied.  This allows the contents to be tokenised in place without
+ * reading the file into a separately allocated buffer.
+ */
+class mapped_file
+{
+public:
+    /** Default constructor, creates an empty mapping. */
+    mapped_file() noexcept = default;
+
+    /** Maps the file at @a path.
+     *
+     * @param path File path
+     * @return Mapping, or an empty optional if the file could not be opened or mapped
+     */
+    [[nodiscard]] static std::optional<mapped_file> open(const string& path)
+    {
+#if defined(__linux__) || defined(__APPLE__)
+        // NOLINTNEXTLINE(*-vararg)
+        const auto fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return {};
+        }
+
+        auto result = std::optional<mapped_file>{};
+        struct stat info {};
+        if (::fstat(fd, &info) == 0) {
+            const auto size = static_cast<std::size_t>(info.st_size);
+            if (size == 0) {
+                result.emplace();
+            } else if (auto* data =
+                           ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+                       data != MAP_FAILED) {
+                result.emplace(static_cast<char*>(data), size);
+            }
+        }
+
+        // The mapping keeps its own reference to the file
+        ::close(fd);
+        return result;
+#elif _WIN32
+        auto* file = ::CreateFileA(path.c_str(),
+                                   GENERIC_READ,
+                                   FILE_SHARE_READ,
+                                   nullptr,
+                                   OPEN_EXISTING,
+                                   FILE_ATTRIBUTE_NORMAL,
+                                   nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return {};
+        }
+
+        auto result = std::optional<mapped_file>{};
+        LARGE_INTEGER size;
+        if (::GetFileSizeEx(file, &size)) {
+            if (size.QuadPart == 0) {
+                result.emplace();
+            } else if (auto* mapping =
+                           ::CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr)) {
+                if (auto* data = ::MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0)) {
+                    result.emplace(static_cast<char*>(data),
+                                   static_cast<std::size_t>(size.QuadPart));
+                }
+                ::CloseHandle(mapping);
+            }
+        }
+
+        ::CloseHandle(file);
+        return result;
+#endif
+    }
+
+    /** Constructor.
+     *
+     * Takes ownership of an existing mapping, use open(const string&) to create one.
+     * @param data Start of the mapping
+     * @param size Size of the mapping in bytes
+     */
+    mapped_file(char* data, std::size_t size) noexcept : data_{data}, size_{size} {}
+
+    /** Move constructor.
+     *
+     * @param other Instance to move from
+     */
+    mapped_file(mapped_file&& other) noexcept :
+        data_{std::exchange(other.data_, nullptr)}, size_{std::exchange(other.size_, 0)}
+    {
+    }
+
+    /** Move assignment.
+     *
+     * @param other Instance to move from
+     * @return Reference to this
+     */
+    mapped_file& operator=(mapped_file&& other) noexcept
+    {
+        if (this != &other) {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    /** Destructor. */
+    ~mapped_file() { unmap(); }
+
+    /** Returns the mapped bytes.
+     *
+     * @return Mapped bytes, empty if the file is empty
+     */
+    [[nodiscard]] span<char> data() const noexcept { return {data_, size_}; }
+
+private:
+    void unmap() noexcept
+    {
+        if (!data_) {
+            return;
+        }
+#if defined(__linux__) || defined(__APPLE__)
+        ::munmap(data_, size_);
+#elif _WIN32
+        ::UnmapViewOfFile(data_);
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    char* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+}  // namespace arg_router::utility
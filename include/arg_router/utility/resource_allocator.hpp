@@ -0,0 +1,187 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+namespace arg_router::utility
+{
+namespace detail
+{
+[[nodiscard]] inline std::pmr::memory_resource*& scoped_memory_resource() noexcept
+{
+    thread_local auto* resource = static_cast<std::pmr::memory_resource*>(nullptr);
+    return resource;
+}
+}  // namespace detail
+
+/** Returns the memory resource that newly constructed resource_allocator instances use on this
+ * thread.
+ *
+ * This is the resource of the innermost memory_resource_scope on this thread, or
+ * <TT>std::pmr::get_default_resource()</TT> if there isn't one.
+ * @return Current memory resource
+ */
+[[nodiscard]] inline std::pmr::memory_resource* current_memory_resource() noexcept
+{
+    auto* resource = detail::scoped_memory_resource();
+    return resource ? resource : std::pmr::get_default_resource();
+}
+
+/** RAII type that sets the current memory resource for this thread, for its lifetime.
+ *
+ * Scopes can be nested, the previous resource is restored on destruction.
+ * @code
+ * auto buffer = std::array<std::byte, 4096>{};
+ * auto arena = std::pmr::monotonic_buffer_resource{buffer.data(), buffer.size()};
+ * {
+ *     const auto scope = utility::memory_resource_scope{arena};
+ *     // All resource_allocator instances created here will use arena
+ * }
+ * @endcode
+ */
+class memory_resource_scope
+{
+public:
+    /** Constructor.
+     *
+     * @param resource Memory resource to use until this is destroyed, it must outlive any
+     * allocations made from it
+     */
+    explicit memory_resource_scope(std::pmr::memory_resource& resource) noexcept :
+        previous_{std::exchange(detail::scoped_memory_resource(), &resource)}
+    {
+    }
+
+    /** Destructor.
+     *
+     * Restores the previous resource.
+     */
+    ~memory_resource_scope() noexcept { detail::scoped_memory_resource() = previous_; }
+
+    memory_resource_scope(const memory_resource_scope&) = delete;
+    memory_resource_scope(memory_resource_scope&&) = delete;
+    memory_resource_scope& operator=(const memory_resource_scope&) = delete;
+    memory_resource_scope& operator=(memory_resource_scope&&) = delete;
+
+private:
+    std::pmr::memory_resource* previous_;
+};
+
+/** An allocator that uses the current memory resource at the time of its construction.
+ *
+ * This is intended to be used as <TT>AR_ALLOCATOR</TT>, it allows the memory used for a parse to
+ * be provided per call (see root_t::parse) rather than being fixed at compile-time.  Unlike
+ * <TT>std::pmr::polymorphic_allocator</TT>, the default resource is thread-specific (see
+ * memory_resource_scope) and it propagates on move assignment and swap.
+ *
+ * Each instance remembers its resource, so memory is always returned to the resource it came
+ * from even if the scope has since ended.
+ * @tparam T Type to allocate for
+ */
+template <typename T>
+class resource_allocator
+{
+public:
+    /** Value type. */
+    using value_type = T;
+    /** Propagate on move assignment. */
+    using propagate_on_container_move_assignment = std::true_type;
+    /** Propagate on swap. */
+    using propagate_on_container_swap = std::true_type;
+    /** Instances are not interchangeable. */
+    using is_always_equal = std::false_type;
+
+    /** Default constructor.
+     *
+     * Uses current_memory_resource().
+     */
+    resource_allocator() noexcept : resource_{current_memory_resource()} {}
+
+    /** Constructor.
+     *
+     * @param resource Memory resource to use, must not be null
+     */
+    explicit resource_allocator(std::pmr::memory_resource* resource) noexcept :
+        resource_{resource}
+    {
+    }
+
+    /** Rebinding copy constructor.
+     *
+     * @tparam U Other value type
+     * @param other Instance to copy the resource from
+     */
+    template <typename U>
+    // NOLINTNEXTLINE(google-explicit-constructor,hicpp-explicit-conversions)
+    resource_allocator(const resource_allocator<U>& other) noexcept : resource_{other.resource()}
+    {
+    }
+
+    /** Allocate memory for @a n objects.
+     *
+     * @param n Number of objects
+     * @return Pointer to the uninitialised memory
+     */
+    [[nodiscard]] T* allocate(std::size_t n)
+    {
+        return static_cast<T*>(resource_->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    /** Return memory to the resource.
+     *
+     * @param p Pointer returned by allocate(std::size_t)
+     * @param n Number of objects passed to allocate(std::size_t)
+     */
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        resource_->deallocate(p, n * sizeof(T), alignof(T));
+    }
+
+    /** Copies of containers use the current memory resource, rather than the source's.
+     *
+     * @return Default constructed instance
+     */
+    [[nodiscard]] resource_allocator select_on_container_copy_construction() const noexcept
+    {
+        return {};
+    }
+
+    /** Returns the memory resource.
+     *
+     * @return Memory resource
+     */
+    [[nodiscard]] std::pmr::memory_resource* resource() const noexcept { return resource_; }
+
+    /** Equality operator.
+     *
+     * @tparam U Other value type
+     * @param other Instance to compare against
+     * @return True if both use equal resources
+     */
+    template <typename U>
+    [[nodiscard]] bool operator==(const resource_allocator<U>& other) const noexcept
+    {
+        return *resource_ == *other.resource();
+    }
+
+    /** Inequality operator.
+     *
+     * @tparam U Other value type
+     * @param other Instance to compare against
+     * @return True if the resources are not equal
+     */
+    template <typename U>
+    [[nodiscard]] bool operator!=(const resource_allocator<U>& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+private:
+    std::pmr::memory_resource* resource_;
+};
+}  // namespace arg_router::utility
@@ -1,4 +1,4 @@
-// Copyright (C) 2022 by Camden Mannett.
+// Copyright (C) 2022-2023 by Camden Mannett.
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
 
@@ -6,6 +6,7 @@
 
 #include "arg_router/exception.hpp"
 
+#include <optional>
 #include <variant>
 
 namespace arg_router::utility
@@ -158,6 +159,15 @@ public:
         return has_result() ? &std::get<0>(data_) : nullptr;
     }
 
+    /** Returns a pointer to the exception, or nullptr if this instance holds a result.
+     *
+     * @return Pointer to the exception, or nullptr
+     */
+    [[nodiscard]] const exception_type* get_error_if() const noexcept
+    {
+        return has_error() ? &std::get<1>(data_) : nullptr;
+    }
+
     /** Move the result of this instance, or throw the exception if one is held.
      *
      * As this method moves the value or exception out of the instance, it should not be called
@@ -205,4 +215,76 @@ public:
 private:
     std::variant<result_type, exception_type> data_;
 };
+
+/** Specialisation for when there is no result value, only success or failure.
+ *
+ * A default constructed instance represents success.
+ * @tparam ExceptionType Exception type
+ */
+template <typename ExceptionType>
+class result<void, ExceptionType>
+{
+public:
+    /** Result type. */
+    using result_type = void;
+    /** Exception type. */
+    using exception_type = ExceptionType;
+
+    /** Success constructor. */
+    constexpr result() noexcept = default;
+
+    /** Exception constructor.
+     *
+     * @param ex Exception
+     */
+    // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+    constexpr result(ExceptionType ex) noexcept : ex_{std::move(ex)} {}
+
+    /** True if this instance represents success.
+     *
+     * @return True if success
+     */
+    [[nodiscard]] constexpr bool has_result() const noexcept { return !ex_; }
+
+    /** True if this instance holds an exception.
+     *
+     * @return True if exception
+     */
+    [[nodiscard]] constexpr bool has_error() const noexcept { return !has_result(); }
+
+    /** True if this instance represents success.
+     *
+     * @return True if success
+     */
+    [[nodiscard]] explicit constexpr operator bool() const noexcept { return has_result(); }
+
+    /** True if this instance holds an exception.
+     *
+     * @return True if exception
+     */
+    [[nodiscard]] constexpr bool operator!() const noexcept { return has_error(); }
+
+    /** Returns a pointer to the exception, or nullptr if this instance represents success.
+     *
+     * @return Pointer to the exception, or nullptr
+     */
+    [[nodiscard]] const exception_type* get_error_if() const noexcept
+    {
+        return ex_ ? &(*ex_) : nullptr;
+    }
+
+    /** Throws the exception if present, otherwise does nothing.
+     *
+     * @exception ExceptionType Thrown if the instance holds an exception
+     */
+    void throw_exception() const
+    {
+        if (has_error()) {
+            throw exception_type{*ex_};
+        }
+    }
+
+private:
+    std::optional<exception_type> ex_;
+};
 }  // namespace arg_router::utility
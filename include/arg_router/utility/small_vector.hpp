@@ -0,0 +1,497 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "arg_router/basic_types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace arg_router::utility
+{
+/** A vector-like container that holds up to @a N elements inline, only using the allocator once
+ * that is exceeded.
+ *
+ * This is used for token storage, where nearly all nodes consume zero or one value tokens, so the
+ * common case never touches the heap.
+ *
+ * To keep the implementation simple, @a T must be trivially copyable so elements can be
+ * relocated with <TT>std::memmove</TT>.  Iterators are invalidated by any operation that changes
+ * the size, and by moving the container.
+ * @tparam T Element type
+ * @tparam N Number of elements held inline
+ * @tparam Allocator Allocator type used when the inline storage is exceeded
+ */
+template <typename T, std::size_t N, typename Allocator = config::allocator<T>>
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+class small_vector
+{
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+    static_assert(N > 0, "Inline capacity must be greater than zero");
+
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+public:
+    using value_type = T;                                  ///< Element type
+    using allocator_type = Allocator;                      ///< Allocator type
+    using size_type = std::size_t;                         ///< Size type
+    using difference_type = std::ptrdiff_t;                ///< Difference type
+    using reference = T&;                                  ///< Reference type
+    using const_reference = const T&;                      ///< Const reference type
+    using pointer = T*;                                    ///< Pointer type
+    using const_pointer = const T*;                        ///< Const pointer type
+    using iterator = T*;                                   ///< Iterator type
+    using const_iterator = const T*;                       ///< Const iterator type
+    using reverse_iterator = std::reverse_iterator<iterator>;              ///< Reverse iterator
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;  ///< Reverse iterator
+
+    /** Number of elements held inline. */
+    constexpr static auto inline_capacity = N;
+
+    /** Default constructor. */
+    small_vector() noexcept : small_vector(Allocator{}) {}
+
+    /** Allocator constructor.
+     *
+     * @param alloc Allocator instance
+     */
+    explicit small_vector(const Allocator& alloc) noexcept : data_{inline_data()}, alloc_(alloc) {}
+
+    /** Initialiser list constructor.
+     *
+     * @param init Initial elements
+     * @param alloc Allocator instance
+     */
+    small_vector(std::initializer_list<T> init, const Allocator& alloc = Allocator{}) :
+        small_vector(init.begin(), init.end(), alloc)
+    {
+    }
+
+    /** Range constructor.
+     *
+     * @tparam Iter Forward iterator type
+     * @param first Iterator to the first element to copy
+     * @param last Iterator to one-past-the-end of the elements to copy
+     * @param alloc Allocator instance
+     */
+    template <typename Iter,
+              typename = std::enable_if_t<!std::is_integral_v<Iter>>>
+    small_vector(Iter first, Iter last, const Allocator& alloc = Allocator{}) : small_vector(alloc)
+    {
+        insert(end(), first, last);
+    }
+
+    /** Copy constructor.
+     *
+     * @param other Instance to copy from
+     */
+    small_vector(const small_vector& other) :
+        small_vector(alloc_traits::select_on_container_copy_construction(other.alloc_))
+    {
+        reserve(other.size_);
+        copy_n(other.data_, other.size_, data_);
+        size_ = other.size_;
+    }
+
+    /** Move constructor.
+     *
+     * If @a other is using the inline storage, then the elements are copied, otherwise the heap
+     * storage is taken.  @a other is left empty.
+     * @param other Instance to move from
+     */
+    small_vector(small_vector&& other) noexcept : small_vector(other.alloc_) { steal(other); }
+
+    /** Destructor. */
+    ~small_vector() { deallocate(); }
+
+    /** Copy assignment.
+     *
+     * If the allocator propagates on copy assignment, then @a other's allocator is taken (after
+     * returning any heap storage to this instance's allocator if they compare unequal).
+     * @param other Instance to copy from
+     * @return Reference to this
+     */
+    small_vector& operator=(const small_vector& other)
+    {
+        if (this != &other) {
+            if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+                if constexpr (!alloc_traits::is_always_equal::value) {
+                    // The heap storage would be returned to the wrong allocator
+                    if (alloc_ != other.alloc_) {
+                        deallocate();
+                        data_ = inline_data();
+                        capacity_ = N;
+                    }
+                }
+                alloc_ = other.alloc_;
+            }
+
+            clear();
+            reserve(other.size_);
+            copy_n(other.data_, other.size_, data_);
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    /** Move assignment.
+     *
+     * If @a other is using heap storage, it is only taken if the allocator propagates on move
+     * assignment or the allocators compare equal, otherwise the elements are copied using this
+     * instance's allocator.  @a other is left empty.
+     * @param other Instance to move from
+     * @return Reference to this
+     */
+    small_vector& operator=(small_vector&& other) noexcept(
+        alloc_traits::propagate_on_container_move_assignment::value ||
+        alloc_traits::is_always_equal::value)
+    {
+        if (this == &other) {
+            return *this;
+        }
+
+        deallocate();
+        data_ = inline_data();
+        size_ = 0;
+        capacity_ = N;
+
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+            alloc_ = other.alloc_;
+        } else if constexpr (!alloc_traits::is_always_equal::value) {
+            // The heap storage would be returned to the wrong allocator
+            if (!other.is_inline() && (alloc_ != other.alloc_)) {
+                reserve(other.size_);
+                copy_n(other.data_, other.size_, data_);
+                size_ = other.size_;
+                other.clear();
+                return *this;
+            }
+        }
+
+        steal(other);
+        return *this;
+    }
+
+    /** Returns the allocator instance.
+     *
+     * @return Allocator
+     */
+    [[nodiscard]] allocator_type get_allocator() const noexcept { return alloc_; }
+
+    /** @return Iterator to the first element */
+    [[nodiscard]] iterator begin() noexcept { return data_; }
+    /** @return Iterator to the first element */
+    [[nodiscard]] const_iterator begin() const noexcept { return data_; }
+    /** @return Iterator to the first element */
+    [[nodiscard]] const_iterator cbegin() const noexcept { return data_; }
+    /** @return Iterator to one-past-the-end */
+    [[nodiscard]] iterator end() noexcept { return data_ + size_; }
+    /** @return Iterator to one-past-the-end */
+    [[nodiscard]] const_iterator end() const noexcept { return data_ + size_; }
+    /** @return Iterator to one-past-the-end */
+    [[nodiscard]] const_iterator cend() const noexcept { return data_ + size_; }
+    /** @return Reverse iterator to the last element */
+    [[nodiscard]] reverse_iterator rbegin() noexcept { return reverse_iterator{end()}; }
+    /** @return Reverse iterator to the last element */
+    [[nodiscard]] const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator{end()};
+    }
+    /** @return Reverse iterator to one-before-the-start */
+    [[nodiscard]] reverse_iterator rend() noexcept { return reverse_iterator{begin()}; }
+    /** @return Reverse iterator to one-before-the-start */
+    [[nodiscard]] const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator{begin()};
+    }
+
+    /** @return Pointer to the elements */
+    [[nodiscard]] pointer data() noexcept { return data_; }
+    /** @return Pointer to the elements */
+    [[nodiscard]] const_pointer data() const noexcept { return data_; }
+
+    /** @return Number of elements */
+    [[nodiscard]] size_type size() const noexcept { return size_; }
+    /** @return True if there are no elements */
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+    /** @return Number of elements that can be held without reallocating */
+    [[nodiscard]] size_type capacity() const noexcept { return capacity_; }
+    /** @return True if the elements are held in the inline storage */
+    [[nodiscard]] bool is_inline() const noexcept { return data_ == inline_data(); }
+
+    /** Element access, no bounds checking.
+     *
+     * @param i Element index
+     * @return Element reference
+     */
+    [[nodiscard]] reference operator[](size_type i) noexcept { return data_[i]; }
+
+    /** Const overload.
+     *
+     * @param i Element index
+     * @return Element reference
+     */
+    [[nodiscard]] const_reference operator[](size_type i) const noexcept { return data_[i]; }
+
+    /** @return First element, undefined if empty */
+    [[nodiscard]] reference front() noexcept { return data_[0]; }
+    /** @return First element, undefined if empty */
+    [[nodiscard]] const_reference front() const noexcept { return data_[0]; }
+    /** @return Last element, undefined if empty */
+    [[nodiscard]] reference back() noexcept { return data_[size_ - 1]; }
+    /** @return Last element, undefined if empty */
+    [[nodiscard]] const_reference back() const noexcept { return data_[size_ - 1]; }
+
+    /** Ensures that at least @a count elements can be held without reallocating.
+     *
+     * @param count Minimum capacity
+     */
+    void reserve(size_type count)
+    {
+        if (count <= capacity_) {
+            return;
+        }
+
+        auto* new_data = alloc_traits::allocate(alloc_, count);
+        copy_n(data_, size_, new_data);
+        deallocate();
+        data_ = new_data;
+        capacity_ = count;
+    }
+
+    /** Replaces the contents with the range [ @a first, @a last ).
+     *
+     * @tparam Iter Forward iterator type
+     * @param first Iterator to the first element to copy
+     * @param last Iterator to one-past-the-end of the elements to copy
+     */
+    template <typename Iter>
+    void assign(Iter first, Iter last)
+    {
+        clear();
+        insert(end(), first, last);
+    }
+
+    /** Removes all elements.  The capacity is unchanged. */
+    void clear() noexcept { size_ = 0; }
+
+    /** Appends @a value.
+     *
+     * @param value Value to append
+     */
+    void push_back(const T& value) { emplace_back(value); }
+
+    /** Constructs a new element at the end in-place.
+     *
+     * @tparam Args Constructor argument types
+     * @param args Constructor arguments
+     * @return Reference to the new element
+     */
+    template <typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        // Construct first in case an argument references an existing element
+        auto value = T{std::forward<Args>(args)...};
+        grow_for(size_ + 1);
+        return *::new (static_cast<void*>(data_ + size_++)) T{value};
+    }
+
+    /** Removes the last element, undefined if empty. */
+    void pop_back() noexcept { --size_; }
+
+    /** Inserts @a value before @a pos.
+     *
+     * @param pos Insertion position
+     * @param value Value to insert
+     * @return Iterator to the inserted element
+     */
+    iterator insert(const_iterator pos, const T& value) { return insert(pos, &value, &value + 1); }
+
+    /** Inserts the range [ @a first, @a last ) before @a pos.
+     *
+     * The range is measured before it is copied, so it is traversed twice.
+     * @tparam Iter Forward iterator type
+     * @param pos Insertion position
+     * @param first Iterator to the first element to insert
+     * @param last Iterator to one-past-the-end of the elements to insert
+     * @return Iterator to the first inserted element, or @a pos if the range is empty
+     */
+    template <typename Iter>
+    iterator insert(const_iterator pos, Iter first, Iter last)
+    {
+        static_assert(std::is_base_of_v<std::forward_iterator_tag,
+                                        typename std::iterator_traits<Iter>::iterator_category>,
+                      "Iter must be a forward iterator");
+
+        const auto offset = static_cast<size_type>(pos - data_);
+        const auto count = static_cast<size_type>(std::distance(first, last));
+        if (count == 0) {
+            return data_ + offset;
+        }
+
+        // The source range may alias this container, so copy it out first if it does (rare)
+        if constexpr (std::is_pointer_v<Iter>) {
+            // Raw comparisons of unrelated pointers are unspecified, std::less is not
+            const auto less = std::less<>{};
+            const auto* source = std::addressof(*first);
+            if (!less(source, data_) && less(source, data_ + size_)) {
+                const auto copy = small_vector{first, last};
+                return insert(data_ + offset, copy.begin(), copy.end());
+            }
+        }
+
+        grow_for(size_ + count);
+        auto* it = data_ + offset;
+        std::memmove(static_cast<void*>(it + count),
+                     static_cast<const void*>(it),
+                     (size_ - offset) * sizeof(T));
+        for (auto* dest = it; first != last; ++first, ++dest) {
+            ::new (static_cast<void*>(dest)) T(*first);
+        }
+        size_ += count;
+
+        return it;
+    }
+
+    /** Removes the element at @a pos.
+     *
+     * @param pos Element to remove
+     * @return Iterator to the element after the removed one
+     */
+    iterator erase(const_iterator pos) noexcept { return erase(pos, pos + 1); }
+
+    /** Removes the elements in the range [ @a first, @a last ).
+     *
+     * @param first First element to remove
+     * @param last One-past-the-last element to remove
+     * @return Iterator to the element after the last removed one
+     */
+    iterator erase(const_iterator first, const_iterator last) noexcept
+    {
+        auto* it = data_ + (first - data_);
+        const auto count = static_cast<size_type>(last - first);
+        std::memmove(static_cast<void*>(it),
+                     static_cast<const void*>(last),
+                     static_cast<size_type>(end() - last) * sizeof(T));
+        size_ -= count;
+
+        return it;
+    }
+
+    /** Element-wise equality with any sized, forward-iterable range (e.g. std::vector).
+     *
+     * @tparam Range Range type
+     * @param lhs Left-hand side
+     * @param rhs Right-hand side
+     * @return True if equal
+     */
+    template <typename Range>
+    [[nodiscard]] friend auto operator==(const small_vector& lhs, const Range& rhs)
+        -> decltype(std::size(rhs), std::begin(rhs), bool{})
+    {
+        return (lhs.size() == std::size(rhs)) &&
+               std::equal(lhs.begin(), lhs.end(), std::begin(rhs));
+    }
+
+    /** Symmetric overload.
+     *
+     * @tparam Range Range type
+     * @param lhs Left-hand side
+     * @param rhs Right-hand side
+     * @return True if equal
+     */
+    template <typename Range,
+              typename = std::enable_if_t<!std::is_same_v<Range, small_vector>>>
+    [[nodiscard]] friend auto operator==(const Range& lhs, const small_vector& rhs)
+        -> decltype(std::size(lhs), std::begin(lhs), bool{})
+    {
+        return rhs == lhs;
+    }
+
+    /** Inequality operator.
+     *
+     * @tparam Range Range type
+     * @param lhs Left-hand side
+     * @param rhs Right-hand side
+     * @return True if not equal
+     */
+    template <typename Range>
+    [[nodiscard]] friend auto operator!=(const small_vector& lhs, const Range& rhs)
+        -> decltype(std::size(rhs), std::begin(rhs), bool{})
+    {
+        return !(lhs == rhs);
+    }
+
+    /** Symmetric overload.
+     *
+     * @tparam Range Range type
+     * @param lhs Left-hand side
+     * @param rhs Right-hand side
+     * @return True if not equal
+     */
+    template <typename Range,
+              typename = std::enable_if_t<!std::is_same_v<Range, small_vector>>>
+    [[nodiscard]] friend auto operator!=(const Range& lhs, const small_vector& rhs)
+        -> decltype(std::size(lhs), std::begin(lhs), bool{})
+    {
+        return !(rhs == lhs);
+    }
+
+private:
+    [[nodiscard]] T* inline_data() noexcept { return reinterpret_cast<T*>(inline_.data()); }
+    [[nodiscard]] const T* inline_data() const noexcept
+    {
+        return reinterpret_cast<const T*>(inline_.data());
+    }
+
+    static void copy_n(const T* src, size_type count, T* dest) noexcept
+    {
+        if (count > 0) {
+            std::memcpy(static_cast<void*>(dest), static_cast<const void*>(src), count * sizeof(T));
+        }
+    }
+
+    void grow_for(size_type count)
+    {
+        if (count > capacity_) {
+            reserve(std::max(count, capacity_ * 2));
+        }
+    }
+
+    void deallocate() noexcept
+    {
+        if (!is_inline()) {
+            alloc_traits::deallocate(alloc_, data_, capacity_);
+        }
+    }
+
+    void steal(small_vector& other) noexcept
+    {
+        if (other.is_inline()) {
+            copy_n(other.data_, other.size_, data_);
+        } else {
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inline_data();
+            other.capacity_ = N;
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+
+    alignas(T) std::array<std::byte, N * sizeof(T)> inline_;
+    T* data_;
+    size_type size_ = 0;
+    size_type capacity_ = N;
+    Allocator alloc_;
+};
+}  // namespace arg_router::utility
@@ -1,4 +1,4 @@
-// Copyright (C) 2022 by Camden Mannett.
+// Copyright (C) 2022-2023 by Camden Mannett.
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
 
@@ -6,13 +6,16 @@
 
 #include "arg_router/config.hpp"
 
-#include <cstring>
-#include <functional>
+#include <cstddef>
+#include <memory>
+#include <utility>
 
 namespace arg_router::utility
 {
 /** Type erasure type similar to <TT>std::any</TT> but has no type checking safety features.
  *
+ * The held type's operations are stored in a static per-type table, so an instance is only the
+ * storage plus a single pointer.
  * @tparam SmallObjectOptimisationSize Size in bytes of the small object optimisation limit.
  * Holding objects larger will incur heap allocation. Defaults to word size
  */
@@ -21,10 +24,117 @@ template <std::size_t SmallObjectOptimisationSize = sizeof(std::size_t)>
 class unsafe_any_t
 {
     using ptr_type = void*;
-    using aligned_storage_type = std::aligned_storage_t<SmallObjectOptimisationSize>;
+    using aligned_storage_type =
+        std::aligned_storage_t<SmallObjectOptimisationSize, alignof(ptr_type)>;
 
+    // The internal move is noexcept, so types that may throw on move are stored externally where
+    // moving only transfers the pointer
     template <typename T>
-    constexpr static bool use_internal_storage = (sizeof(T) <= sizeof(aligned_storage_type));
+    constexpr static bool use_internal_storage =
+        (sizeof(T) <= sizeof(aligned_storage_type)) &&
+        (alignof(std::decay_t<T>) <= alignof(aligned_storage_type)) &&
+        std::is_nothrow_move_constructible_v<std::decay_t<T>>;
+
+    union storage_type {
+        constexpr storage_type() noexcept : ptr{nullptr} {}
+
+        ptr_type ptr;
+        aligned_storage_type buffer;
+    };
+
+    struct vtable_type {
+        // Copy constructs into the empty destination
+        void (*copy)(storage_type& dest, const storage_type& src);
+        // Move constructs into the empty destination, leaving the source empty
+        void (*move)(storage_type& dest, storage_type& src) noexcept;
+        void (*destroy)(storage_type& storage) noexcept;
+    };
+
+    template <typename T>
+    struct internal_ops {
+        static void copy(storage_type& dest, const storage_type& src)
+        {
+            new (&dest.buffer) T(*reinterpret_cast<const T*>(&src.buffer));
+        }
+
+        static void move(storage_type& dest, storage_type& src) noexcept
+        {
+            auto src_ptr = reinterpret_cast<T*>(&src.buffer);
+            new (&dest.buffer) T(std::move(*src_ptr));
+            src_ptr->~T();
+        }
+
+        static void destroy(storage_type& storage) noexcept
+        {
+            reinterpret_cast<T*>(&storage.buffer)->~T();
+        }
+
+        constexpr static auto vtable = vtable_type{&copy, &move, &destroy};
+    };
+
+    template <typename T, typename Allocator>
+    struct external_ops {
+        // The allocator is stored alongside the value as it may be stateful.  The value storage is
+        // the first member so the block's address is the value's address
+        struct block_type {
+            template <typename U>
+            block_type(U&& v, const Allocator& a) : alloc{a}
+            {
+                new (&value) T(std::forward<U>(v));
+            }
+
+            alignas(T) std::byte value[sizeof(T)];
+            Allocator alloc;
+        };
+        static_assert(std::is_standard_layout_v<block_type>, "Allocator must be standard layout");
+
+        using block_allocator_type =
+            typename std::allocator_traits<Allocator>::template rebind_alloc<block_type>;
+        using block_traits = std::allocator_traits<block_allocator_type>;
+
+        template <typename U>
+        static void create(storage_type& storage, U&& value, const Allocator& alloc)
+        {
+            auto block_alloc = block_allocator_type{alloc};
+            auto block = block_traits::allocate(block_alloc, 1);
+            try {
+                block_traits::construct(block_alloc, block, std::forward<U>(value), alloc);
+            } catch (...) {
+                block_traits::deallocate(block_alloc, block, 1);
+                throw;
+            }
+
+            storage.ptr = block;
+        }
+
+        static void copy(storage_type& dest, const storage_type& src)
+        {
+            const auto& src_block = *reinterpret_cast<const block_type*>(src.ptr);
+            create(dest,
+                   *reinterpret_cast<const T*>(&src_block.value),
+                   std::allocator_traits<Allocator>::select_on_container_copy_construction(
+                       src_block.alloc));
+        }
+
+        static void move(storage_type& dest, storage_type& src) noexcept
+        {
+            dest.ptr = src.ptr;
+            src.ptr = nullptr;
+        }
+
+        static void destroy(storage_type& storage) noexcept
+        {
+            auto block = reinterpret_cast<block_type*>(storage.ptr);
+            auto block_alloc = block_allocator_type{block->alloc};
+
+            reinterpret_cast<T*>(&block->value)->~T();
+            block_traits::destroy(block_alloc, block);
+            block_traits::deallocate(block_alloc, block, 1);
+            storage.ptr = nullptr;
+        }
+
+        constexpr static auto vtable = vtable_type{&copy, &move, &destroy};
+    };
 
 public:
     /** Default constructor.
@@ -36,7 +146,7 @@ public:
     /** Constructs an unsafe_any_t from @a value.
      *
      * This constructor only takes part in overload resolution if @a T fits inside the internal
-     * storage.
+     * storage and has a non-throwing move constructor.
      * @tparam T Type to construct from
      * @param value Value to initialise from, will move construct if an rvalue is passed in
      */
@@ -50,22 +160,16 @@ public:
 
         // Build in buffer
         new (&storage_.buffer) value_type(std::forward<T>(value));
-
-        copier_ = [](const storage_type& storage) -> unsafe_any_t {
-            return *reinterpret_cast<const value_type*>(&storage.buffer);
-        };
-        destroyer_ = [](storage_type& storage) {
-            auto ptr = reinterpret_cast<value_type*>(&storage.buffer);
-            ptr->~value_type();
-        };
+        vtable_ = &internal_ops<value_type>::vtable;
     }
 
     /** Constructs an unsafe_any_t from @a value.
      *
      * This constructor only takes part in overload resolution if @a T does not fit inside the
-     * internal storage.
+     * internal storage, or its move constructor may throw.
      * @tparam T Type to construct from
-     * @tparam Allocator Allocator type, only used when not using internal storage
+     * @tparam Allocator Allocator type, only used when not using internal storage.  A copy is
+     * stored alongside the value
      * @param value Value to initialise from, will move construct if an rvalue is passed in
      * @param alloc Allocator instance
      */
@@ -79,19 +183,8 @@ public:
         using value_type = std::decay_t<T>;
 
         // Build using memory from allocator
-        storage_.ptr = alloc.allocate(1);
-        new (storage_.ptr) value_type(std::forward<T>(value));
-
-        copier_ = [](const storage_type& storage) -> unsafe_any_t {
-            return *reinterpret_cast<const value_type*>(storage.ptr);
-        };
-        destroyer_ = [alloc = std::move(alloc)](storage_type& storage) mutable noexcept {
-            auto s_ptr = reinterpret_cast<value_type*>(storage.ptr);
-
-            std::allocator_traits<Allocator>::destroy(alloc, s_ptr);
-            alloc.deallocate(s_ptr, 1);
-            storage.ptr = nullptr;
-        };
+        external_ops<value_type, Allocator>::create(storage_, std::forward<T>(value), alloc);
+        vtable_ = &external_ops<value_type, Allocator>::vtable;
     }
 
     /** Move constructor.
@@ -99,7 +192,7 @@ public:
      * @note @a other is left in an empty state (i.e. has_value() returns false).
      * @param other Instance to move from
      */
-    unsafe_any_t(unsafe_any_t&& other) noexcept { swap(*this, other); }
+    unsafe_any_t(unsafe_any_t&& other) noexcept { move_from(other); }
 
     /** Copy constructor.
      *
@@ -107,8 +200,10 @@ public:
      */
     unsafe_any_t(const unsafe_any_t& other)
     {
-        auto new_any = other.copier_(other.storage_);
-        swap(*this, new_any);
+        if (other.vtable_) {
+            other.vtable_->copy(storage_, other.storage_);
+            vtable_ = other.vtable_;
+        }
     }
 
     /** Assignment operator.
@@ -118,25 +213,21 @@ public:
      */
     unsafe_any_t& operator=(unsafe_any_t other) noexcept
     {
-        swap(*this, other);
+        reset();
+        move_from(other);
         return *this;
     }
 
     /** Destructor.
      */
-    ~unsafe_any_t() noexcept
-    {
-        if (destroyer_) {
-            destroyer_(storage_);
-        }
-    }
+    ~unsafe_any_t() noexcept { reset(); }
 
     /** Returns true if the any is holding a value.
      *
      * This is false if the instance has been moved from.
      * @return True if the any is holding a value
      */
-    [[nodiscard]] bool has_value() const noexcept { return !!destroyer_; }
+    [[nodiscard]] bool has_value() const noexcept { return vtable_ != nullptr; }
 
     /** Returns a reference to the held object.
      *
@@ -185,24 +276,31 @@ public:
      */
     friend void swap(unsafe_any_t& a, unsafe_any_t& b) noexcept
     {
-        using std::swap;
-
-        swap(a.storage_, b.storage_);
-        swap(a.copier_, b.copier_);
-        swap(a.destroyer_, b.destroyer_);
+        auto tmp = unsafe_any_t{std::move(a)};
+        a.move_from(b);
+        b.move_from(tmp);
     }
 
 private:
-    union storage_type {
-        constexpr storage_type() noexcept : ptr{nullptr} {}
+    // Assumes this is empty
+    void move_from(unsafe_any_t& other) noexcept
+    {
+        if (other.vtable_) {
+            other.vtable_->move(storage_, other.storage_);
+            vtable_ = std::exchange(other.vtable_, nullptr);
+        }
+    }
 
-        ptr_type ptr;
-        aligned_storage_type buffer;
-    };
+    void reset() noexcept
+    {
+        if (vtable_) {
+            vtable_->destroy(storage_);
+            vtable_ = nullptr;
+        }
+    }
 
     storage_type storage_;
-    std::function<unsafe_any_t(const storage_type&)> copier_;
-    std::function<void(storage_type&)> destroyer_;
+    const vtable_type* vtable_ = nullptr;
 };
 
 /** Typedef for an unsafe_any_t with internal storage big enough to fit a <TT>std::string_view</TT>.
@@ -79,7 +79,7 @@ template <typename Node>
 
     // The token may not have been processed yet, so do a type conversion to be sure
     if (token.prefix == parsing::prefix_type::none) {
-        token = parsing::get_token_type(token.name);
+        token = parsing::get_token_type(token);
     }
 
     utility::tree_recursor(
@@ -5,21 +5,46 @@
 #undef AR_ALLOCATOR
 #define AR_ALLOCATOR tracking_allocator
 
+#include <cstdlib>
 #include <memory>
+#include <new>
 
 struct allocator_fixture {
     static std::size_t allocated_bytes;
     static std::size_t current_bytes;
+    static std::size_t global_allocations;
 
     allocator_fixture()
     {
         allocated_bytes = 0;
         current_bytes = 0;
+        global_allocations = 0;
     }
 };
 
 std::size_t allocator_fixture::allocated_bytes = 0;
 std::size_t allocator_fixture::current_bytes = 0;
+std::size_t allocator_fixture::global_allocations = 0;
+
+// Count all the global heap allocations, so we can check allocations that bypass AR_ALLOCATOR
+void* operator new(std::size_t count)
+{
+    ++allocator_fixture::global_allocations;
+    if (auto* p = std::malloc(count == 0 ? 1 : count)) {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, [[maybe_unused]] std::size_t count) noexcept
+{
+    std::free(p);
+}
 
 template <typename T>
 class tracking_allocator
@@ -61,6 +86,7 @@ public:
     bool operator!=(const tracking_allocator& other) const noexcept { return !(*this == other); }
 };
 
+#include "arg_router/arg.hpp"
 #include "arg_router/basic_types.hpp"
 #include "arg_router/flag.hpp"
 #include "arg_router/mode.hpp"
@@ -103,6 +129,67 @@ BOOST_FIXTURE_TEST_CASE(vector_test, allocator_fixture)
     BOOST_CHECK_GT(allocator_fixture::allocated_bytes, 42u);
 }
 
+BOOST_FIXTURE_TEST_CASE(parse_target_test, allocator_fixture)
+{
+    const auto f = flag(policy::long_name<AR_STRING("hello")>);
+
+    // Lots of 'parents' to exceed the small buffer size of any type-erased callable.  The checks
+    // are deferred and the counters reset here, as the test framework can allocate
+    allocator_fixture::allocated_bytes = 0;
+    allocator_fixture::global_allocations = 0;
+
+    auto target = parsing::parse_target{f, f, f, f, f, f, f, f};
+    const auto valid = static_cast<bool>(target);
+
+    auto moved = std::move(target);
+    const auto result = moved();
+    const auto invalid = !moved;
+
+    const auto allocated_bytes = allocator_fixture::allocated_bytes;
+    const auto global_allocations = allocator_fixture::global_allocations;
+
+    BOOST_CHECK(valid);
+    BOOST_CHECK(result.get<bool>());
+    BOOST_CHECK(invalid);
+    BOOST_CHECK_EQUAL(allocated_bytes, 0u);
+    BOOST_CHECK_EQUAL(global_allocations, 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(pre_parse_and_parse_test, allocator_fixture)
+{
+    const auto f = flag(policy::long_name<AR_STRING("hello")>);
+    const auto a = arg<int>(policy::long_name<AR_STRING("arg")>);
+
+    auto flag_args = parsing::token_list{{parsing::prefix_type::none, "--hello"}};
+    auto arg_args = parsing::token_list{{parsing::prefix_type::none, "--arg"},
+                                        {parsing::prefix_type::none, "42"}};
+
+    // The label and value tokens fit in the parse target's inline token storage, so matching and
+    // parsing these nodes should not touch the heap
+    allocator_fixture::allocated_bytes = 0;
+    allocator_fixture::global_allocations = 0;
+
+    auto flag_target = f.pre_parse(parsing::pre_parse_data{flag_args}).extract();
+    const auto flag_matched = flag_target.has_value();
+    const auto flag_result = flag_matched ? (*flag_target)().get<bool>() : false;
+
+    auto arg_target = a.pre_parse(parsing::pre_parse_data{arg_args}).extract();
+    const auto arg_matched = arg_target.has_value();
+    const auto arg_result = arg_matched ? (*arg_target)().get<int>() : 0;
+
+    const auto allocated_bytes = allocator_fixture::allocated_bytes;
+    const auto global_allocations = allocator_fixture::global_allocations;
+
+    BOOST_CHECK(flag_matched);
+    BOOST_CHECK(flag_result);
+    BOOST_CHECK(arg_matched);
+    BOOST_CHECK_EQUAL(arg_result, 42);
+    BOOST_CHECK(flag_args.empty());
+    BOOST_CHECK(arg_args.empty());
+    BOOST_CHECK_EQUAL(allocated_bytes, 0u);
+    BOOST_CHECK_EQUAL(global_allocations, 0u);
+}
+
 BOOST_FIXTURE_TEST_CASE(root_test, allocator_fixture)
 {
     {
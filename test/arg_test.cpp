@@ -39,7 +39,9 @@ BOOST_AUTO_TEST_CASE(parse_test)
                  const auto&... parents) {
         router_hit = false;
 
-        auto target = parsing::parse_target{std::move(tokens), node, parents...};
+        auto target = parsing::parse_target{parsing::token_buffer(tokens.begin(), tokens.end()),
+                                            node,
+                                            parents...};
         const auto result = node.parse(std::move(target), parents...);
         BOOST_CHECK_EQUAL(result, expected_result);
         BOOST_CHECK_EQUAL(router_hit, expected_router_hit);
@@ -40,7 +40,10 @@ public:
         const Parents&... parents) const
     {
         if (return_value) {
-            return parsing::parse_target{std::move(pre_parse_data.args()), *this, parents...};
+            auto& args = pre_parse_data.args();
+            auto tokens = parsing::token_buffer(args.begin(), args.end());
+            args.clear();
+            return parsing::parse_target{std::move(tokens), *this, parents...};
         }
 
         return {};
@@ -128,8 +131,9 @@ BOOST_AUTO_TEST_CASE(pre_parse_test)
         auto& not_expected_child = std::get<(child_index == 0 ? 1 : 0)>(node.children());
         not_expected_child.return_value = false;
 
-        auto expected_args_copy = expected_args;
-        auto result = node.pre_parse(parsing::pre_parse_data{expected_args_copy}, fake_parent);
+        auto expected_args_copy = parsing::token_list{expected_args};
+        auto result =
+            node.pre_parse(parsing::pre_parse_data{expected_args_copy}, fake_parent).extract();
         BOOST_CHECK_EQUAL(!result, !expected_result);
 
         if (result) {
@@ -39,7 +39,10 @@ public:
         const Parents&... parents) const
     {
         if (return_value) {
-            return parsing::parse_target{std::move(pre_parse_data.args()), *this, parents...};
+            auto& args = pre_parse_data.args();
+            auto tokens = parsing::token_buffer(args.begin(), args.end());
+            args.clear();
+            return parsing::parse_target{std::move(tokens), *this, parents...};
         }
 
         return {};
@@ -129,8 +132,9 @@ BOOST_AUTO_TEST_CASE(pre_parse_test)
         auto& not_expected_child = std::get<(child_index == 0 ? 1 : 0)>(node.children());
         not_expected_child.return_value = false;
 
-        auto expected_args_copy = expected_args;
-        auto result = node.pre_parse(parsing::pre_parse_data{expected_args_copy}, fake_parent);
+        auto expected_args_copy = parsing::token_list{expected_args};
+        auto result =
+            node.pre_parse(parsing::pre_parse_data{expected_args_copy}, fake_parent).extract();
         BOOST_CHECK_EQUAL(!result, !expected_result);
 
         if (result) {
@@ -178,16 +182,42 @@ BOOST_AUTO_TEST_CASE(one_of_fail_test)
                             stub_node{policy::long_name<AR_STRING("arg2")>},
                             policy::required);
 
+    // The selection is tracked via the parent's target, so without one there's no persistence
+    // between pre-parse calls
     std::get<0>(node.children()).return_value = true;
     std::get<1>(node.children()).return_value = false;
-    auto expected_args = std::vector<parsing::token_type>{{parsing::prefix_type::none, "hello"}};
-    auto result = node.pre_parse(parsing::pre_parse_data{expected_args}, fake_parent);
+    auto expected_args = parsing::token_list{{parsing::prefix_type::none, "hello"}};
+    auto result = node.pre_parse(parsing::pre_parse_data{expected_args}, fake_parent).extract();
     BOOST_CHECK(result);
 
     std::get<0>(node.children()).return_value = false;
     std::get<1>(node.children()).return_value = true;
+    expected_args = parsing::token_list{{parsing::prefix_type::none, "hello"}};
+    result = node.pre_parse(parsing::pre_parse_data{expected_args}, fake_parent).extract();
+    BOOST_CHECK(result);
+
+    // Stand-in for the owning mode's target, it's never invoked
+    auto parent_target = parsing::parse_target{fake_parent, fake_parent};
+    std::get<0>(node.children()).return_value = true;
+    std::get<1>(node.children()).return_value = false;
+    expected_args = parsing::token_list{{parsing::prefix_type::none, "hello"}};
+    result = node.pre_parse(parsing::pre_parse_data{expected_args, parent_target}, fake_parent)
+                 .extract();
+    BOOST_REQUIRE(result);
+    parent_target.add_sub_target(std::move(*result));
+
+    // Same child again is fine
+    expected_args = parsing::token_list{{parsing::prefix_type::none, "hello"}};
+    result = node.pre_parse(parsing::pre_parse_data{expected_args, parent_target}, fake_parent)
+                 .extract();
+    BOOST_CHECK(result);
+
+    std::get<0>(node.children()).return_value = false;
+    std::get<1>(node.children()).return_value = true;
+    expected_args = parsing::token_list{{parsing::prefix_type::none, "hello"}};
     BOOST_CHECK_EXCEPTION(  //
-        (void)node.pre_parse(parsing::pre_parse_data{expected_args}, fake_parent),
+        (void)node.pre_parse(parsing::pre_parse_data{expected_args, parent_target}, fake_parent)
+            .extract(),
         multi_lang_exception,
         [](const auto& e) {
             return (e.ec() == error_code::one_of_selected_type_mismatch) &&
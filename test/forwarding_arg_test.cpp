@@ -29,9 +29,17 @@ BOOST_AUTO_TEST_CASE(policies_test)
 BOOST_AUTO_TEST_CASE(parse_test)
 {
     auto f = [&](auto node, auto tokens, auto expected_result) {
-        auto target = parsing::parse_target{std::move(tokens), node};
+        auto target =
+            parsing::parse_target{parsing::token_buffer(tokens.begin(), tokens.end()), node};
         const auto result = node.parse(std::move(target));
         BOOST_CHECK_EQUAL(result, expected_result);
+
+        // The result is allocated once and views the original token strings
+        BOOST_CHECK_EQUAL(result.capacity(), result.size());
+        for (auto i = 0u; i < result.size(); ++i) {
+            BOOST_CHECK_EQUAL(static_cast<const void*>(result[i].data()),
+                              static_cast<const void*>(tokens[i].name.data()));
+        }
     };
 
     test::data_set(
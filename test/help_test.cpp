@@ -73,14 +73,14 @@ BOOST_AUTO_TEST_CASE(parse_test)
     auto output = ""s;
     auto f = [&](const auto& root,
                  auto help_index,
-                 auto tokens,
+                 parsing::token_list tokens,
                  const auto& ec,
                  const auto& expected_output) {
         output.clear();
 
         try {
             const auto& help_node = std::get<help_index>(root.children());
-            auto target = help_node.pre_parse(parsing::pre_parse_data{tokens}, root);
+            auto target = help_node.pre_parse(parsing::pre_parse_data{tokens}, root).extract();
 
             help_node.parse(std::move(*target), root);
             BOOST_CHECK(!ec);
@@ -489,7 +489,7 @@ struct mock_root {};
 int main() {
     const auto m = help(policy::long_name<AR_STRING("help")>);
 
-    auto tokens = vector<parsing::token_type>{};
+    auto tokens = parsing::token_list{};
     const auto result = m.pre_parse(parsing::pre_parse_data{tokens});
     return 0;
 }
@@ -74,6 +74,38 @@ BOOST_AUTO_TEST_CASE(anonymous_test)
                   "Fail");
 }
 
+BOOST_AUTO_TEST_CASE(node_index_test)
+{
+    const auto m = mode(flag(policy::long_name<AR_STRING("hello")>),
+                        ard::alias_group(arg<int>(policy::long_name<AR_STRING("arg")>),
+                                         counting_flag<int>(policy::short_name<'a'>),
+                                         policy::required),
+                        arg<int>(policy::long_name<AR_STRING("other")>),
+                        policy::router([](bool, int, int) {}));
+    using mode_type = std::decay_t<decltype(m)>;
+
+    const auto& hello = std::get<0>(m.children());
+    const auto& group = std::get<1>(m.children());
+    const auto& group_arg = std::get<0>(group.children());
+    const auto& group_flag = std::get<1>(group.children());
+    const auto& other = std::get<2>(m.children());
+
+    // The alias_group itself does not have a parse method, so is not indexed
+    static_assert(mode_type::node_index<std::decay_t<decltype(hello)>> == 0);
+    static_assert(mode_type::node_index<std::decay_t<decltype(group)>> ==
+                  parsing::parse_target::no_index);
+    static_assert(mode_type::node_index<std::decay_t<decltype(group_arg)>> == 1);
+    static_assert(mode_type::node_index<std::decay_t<decltype(group_flag)>> == 2);
+    static_assert(mode_type::node_index<std::decay_t<decltype(other)>> == 3);
+    static_assert(mode_type::node_index<mode_type> == parsing::parse_target::no_index);
+
+    // The nearest indexing parent is used
+    BOOST_CHECK_EQUAL((parsing::parse_target{other, m}.node_index()), 3);
+    BOOST_CHECK_EQUAL((parsing::parse_target{group_flag, group, m}.node_index()), 2);
+    BOOST_CHECK_EQUAL((parsing::parse_target{other}.node_index()), parsing::parse_target::no_index);
+    BOOST_CHECK_EQUAL((parsing::parse_target{m}.node_index()), parsing::parse_target::no_index);
+}
+
 BOOST_AUTO_TEST_CASE(anonymous_single_flag_pre_parse_test)
 {
     const auto m = mode(flag(policy::long_name<AR_STRING("hello")>,
@@ -81,9 +113,9 @@ BOOST_AUTO_TEST_CASE(anonymous_single_flag_pre_parse_test)
                              policy::description<AR_STRING("Hello arg")>),
                         policy::router{[](auto) {}});
 
-    auto f = [&](auto args, auto expected_args, auto expected_result, auto ec) {
+    auto f = [&](parsing::token_list args, auto expected_args, auto expected_result, auto ec) {
         try {
-            auto result = m.pre_parse(parsing::pre_parse_data{args});
+            auto result = m.pre_parse(parsing::pre_parse_data{args}).extract();
 
             BOOST_CHECK(!ec);
             BOOST_CHECK_EQUAL(args, expected_args);
@@ -217,9 +249,12 @@ BOOST_AUTO_TEST_CASE(anonymous_triple_child_pre_parse_test)
                                                    policy::description<AR_STRING("b arg")>),
                         policy::router{[](bool, int, std::size_t) {}});
 
-    auto f = [&](auto args, auto expected_args, const auto& expected_results, auto ec) {
+    auto f = [&](parsing::token_list args,
+                 auto expected_args,
+                 const auto& expected_results,
+                 auto ec) {
         try {
-            auto result = m.pre_parse(parsing::pre_parse_data{args});
+            auto result = m.pre_parse(parsing::pre_parse_data{args}).extract();
 
             BOOST_CHECK(!ec);
             BOOST_CHECK_EQUAL(args, expected_args);
@@ -325,10 +360,10 @@ BOOST_AUTO_TEST_CASE(anonymous_triple_child_parse_test)
                             result = std::tuple{f1, f2, f3};
                         }));
 
-    auto f = [&](auto tokens, auto expected_result, auto ec) {
+    auto f = [&](parsing::token_list tokens, auto expected_result, auto ec) {
         result.reset();
         try {
-            auto target = m.pre_parse(parsing::pre_parse_data{tokens});
+            auto target = m.pre_parse(parsing::pre_parse_data{tokens}).extract();
             BOOST_REQUIRE(target);
 
             (*target)();
@@ -376,6 +411,51 @@ BOOST_AUTO_TEST_CASE(anonymous_triple_child_parse_test)
         });
 }
 
+BOOST_AUTO_TEST_CASE(pre_parse_error_no_throw_test)
+{
+    const auto m = mode(flag(policy::long_name<AR_STRING("hello")>),
+                        arg<int>(policy::long_name<AR_STRING("foo")>),
+                        policy::router([](bool, int) {}));
+
+    auto f = [&](parsing::token_list tokens, const multi_lang_exception& expected) {
+        // Pre-parse errors are returned rather than thrown
+        auto result = std::optional<parsing::pre_parse_target_result>{};
+        BOOST_CHECK_NO_THROW(result = m.pre_parse(parsing::pre_parse_data{tokens}));
+        BOOST_REQUIRE(result);
+
+        const auto* e = result->get_error_if();
+        BOOST_REQUIRE(e);
+        BOOST_CHECK_EQUAL(e->ec(), expected.ec());
+        BOOST_CHECK_EQUAL(e->tokens(), expected.tokens());
+    };
+
+    test::data_set(
+        f,
+        {
+            std::tuple{parsing::token_list{{parsing::prefix_type::long_, "unknown"}},
+                       multi_lang_exception{error_code::unknown_argument_with_suggestion,
+                                            vector<parsing::token_type>{
+                                                {parsing::prefix_type::long_, "unknown"},
+                                                {parsing::prefix_type::long_, "hello"}}}},
+            std::tuple{parsing::token_list{{parsing::prefix_type::long_, "hello"},
+                                           {parsing::prefix_type::long_, "hello"}},
+                       multi_lang_exception{error_code::argument_has_already_been_set,
+                                            parsing::token_type{parsing::prefix_type::long_,
+                                                                "hello"}}},
+            std::tuple{parsing::token_list{{parsing::prefix_type::long_, "foo"}},
+                       multi_lang_exception{error_code::minimum_count_not_reached,
+                                            parsing::token_type{parsing::prefix_type::long_,
+                                                                "foo"}}},
+            std::tuple{parsing::token_list{{parsing::prefix_type::long_, "hello"},
+                                           {parsing::prefix_type::long_, "foo"},
+                                           {parsing::prefix_type::none, "42"},
+                                           {parsing::prefix_type::none, "bar"}},
+                       multi_lang_exception{error_code::unhandled_arguments,
+                                            parsing::token_type{parsing::prefix_type::none,
+                                                                "bar"}}},
+        });
+}
+
 BOOST_AUTO_TEST_CASE(named_single_flag_parse_test)
 {
     auto result = std::optional<bool>{};
@@ -385,10 +465,10 @@ BOOST_AUTO_TEST_CASE(named_single_flag_parse_test)
                              policy::description<AR_STRING("Hello arg")>),
                         policy::router([&](bool f1) { result = f1; }));
 
-    auto f = [&](auto tokens, auto expected_result, auto ec) {
+    auto f = [&](parsing::token_list tokens, auto expected_result, auto ec) {
         result.reset();
         try {
-            auto target = m.pre_parse(parsing::pre_parse_data{tokens});
+            auto target = m.pre_parse(parsing::pre_parse_data{tokens}).extract();
             BOOST_REQUIRE(target);
 
             (*target)();
@@ -431,9 +511,12 @@ BOOST_AUTO_TEST_CASE(named_triple_arg_pre_parse_test)
                         flag(policy::short_name<'b'>, policy::description<AR_STRING("b arg")>),
                         policy::router{[](bool, int, bool) {}});
 
-    auto f = [&](auto args, auto expected_args, const auto& expected_results, auto ec) {
+    auto f = [&](parsing::token_list args,
+                 auto expected_args,
+                 const auto& expected_results,
+                 auto ec) {
         try {
-            auto result = m.pre_parse(parsing::pre_parse_data{args});
+            auto result = m.pre_parse(parsing::pre_parse_data{args}).extract();
 
             BOOST_CHECK(!ec);
             BOOST_CHECK_EQUAL(args, expected_args);
@@ -543,10 +626,10 @@ BOOST_AUTO_TEST_CASE(named_triple_arg_parse_test)
                             result = std::tuple{f1, f2, f3};
                         }));
 
-    auto f = [&](auto tokens, auto expected_result, auto ec) {
+    auto f = [&](parsing::token_list tokens, auto expected_result, auto ec) {
         result.reset();
         try {
-            auto target = m.pre_parse(parsing::pre_parse_data{tokens});
+            auto target = m.pre_parse(parsing::pre_parse_data{tokens}).extract();
             BOOST_REQUIRE(target);
 
             (*target)();
@@ -611,9 +694,12 @@ BOOST_AUTO_TEST_CASE(anonymous_triple_flag_single_list_pre_parse_test)
     };
     const auto m = mode(flags, policy::router{[](bool, bool, bool) {}});
 
-    auto f = [&](auto args, auto expected_args, const auto& expected_results, auto ec) {
+    auto f = [&](parsing::token_list args,
+                 auto expected_args,
+                 const auto& expected_results,
+                 auto ec) {
         try {
-            auto result = m.pre_parse(parsing::pre_parse_data{args});
+            auto result = m.pre_parse(parsing::pre_parse_data{args}).extract();
 
             BOOST_CHECK(!ec);
             BOOST_CHECK_EQUAL(args, expected_args);
@@ -672,9 +758,12 @@ BOOST_AUTO_TEST_CASE(named_triple_flag_double_list_pre_parse_test)
                         list2,
                         policy::router{[](bool, bool, bool) {}});
 
-    auto f = [&](auto args, auto expected_args, const auto& expected_results, auto ec) {
+    auto f = [&](parsing::token_list args,
+                 auto expected_args,
+                 const auto& expected_results,
+                 auto ec) {
         try {
-            auto result = m.pre_parse(parsing::pre_parse_data{args});
+            auto result = m.pre_parse(parsing::pre_parse_data{args}).extract();
 
             BOOST_CHECK(!ec);
             BOOST_CHECK_EQUAL(args, expected_args);
@@ -747,13 +836,13 @@ BOOST_AUTO_TEST_CASE(nested_modes_pre_parse_test)
                                            policy::default_value{42}),
                                   policy::router{[](bool, int) {}})));
 
-    auto f = [&](auto args,
+    auto f = [&](parsing::token_list args,
                  auto expected_args,
                  auto expected_hash,
                  const auto& expected_results,
                  auto ec) {
         try {
-            auto result = m.pre_parse(parsing::pre_parse_data{args});
+            auto result = m.pre_parse(parsing::pre_parse_data{args}).extract();
 
             BOOST_CHECK(!ec);
             BOOST_CHECK_EQUAL(args, expected_args);
@@ -869,10 +958,10 @@ BOOST_AUTO_TEST_CASE(nested_modes_parse_test)
                                       result = std::tuple{f1, f2};
                                   }))));
 
-    auto f = [&](auto tokens, auto expected_result, auto ec) {
+    auto f = [&](parsing::token_list tokens, auto expected_result, auto ec) {
         result.reset();
         try {
-            auto target = m.pre_parse(parsing::pre_parse_data{tokens});
+            auto target = m.pre_parse(parsing::pre_parse_data{tokens}).extract();
             BOOST_REQUIRE(target);
 
             (*target)();
@@ -1088,11 +1177,11 @@ BOOST_AUTO_TEST_CASE(multi_stage_alias_group_test)
                                          policy::required),
                         policy::router([&](int value) { result = value; }));
 
-    auto tokens = std::vector<parsing::token_type>{{parsing::prefix_type::long_, "arg"},
-                                                   {parsing::prefix_type::none, "5"},
-                                                   {parsing::prefix_type::short_, "a"}};
+    auto tokens = parsing::token_list{{parsing::prefix_type::long_, "arg"},
+                                      {parsing::prefix_type::none, "5"},
+                                      {parsing::prefix_type::short_, "a"}};
 
-    auto target = m.pre_parse(parsing::pre_parse_data{tokens});
+    auto target = m.pre_parse(parsing::pre_parse_data{tokens}).extract();
     BOOST_REQUIRE(target);
 
     (*target)();
@@ -1108,10 +1197,10 @@ BOOST_AUTO_TEST_CASE(multi_stage_validated_alias_group_test)
                                          policy::required),
                         policy::router([&](int value) { result = value; }));
 
-    auto f = [&](auto tokens, auto expected_result, auto ec) {
+    auto f = [&](parsing::token_list tokens, auto expected_result, auto ec) {
         result = 0;
         try {
-            auto target = m.pre_parse(parsing::pre_parse_data{tokens});
+            auto target = m.pre_parse(parsing::pre_parse_data{tokens}).extract();
             BOOST_REQUIRE(target);
 
             (*target)();
@@ -1203,10 +1292,10 @@ int main() {
 using namespace arg_router;
 
 int main() {
-    auto tokens = std::vector<parsing::token_type>{
+    auto tokens = parsing::token_list{
                     {parsing::prefix_type::long_, "hello"}};
     const auto m = mode(flag(policy::long_name<AR_STRING("hello")>));
-    auto target = m.pre_parse(parsing::pre_parse_data{tokens});
+    auto target = m.pre_parse(parsing::pre_parse_data{tokens}).extract();
     (*target)();
     return 0;
 }
@@ -1294,7 +1383,7 @@ public:
     }
 
     template <typename Validator, bool HasTarget, typename... Parents>
-    [[nodiscard]] std::optional<parsing::parse_target> pre_parse(
+    [[nodiscard]] parsing::pre_parse_target_result pre_parse(
         parsing::pre_parse_data<Validator, HasTarget> pre_parse_data,
         const Parents&... parents) const
     {
@@ -1312,7 +1401,7 @@ int main() {
                              mode(flag(policy::long_name<AR_STRING("hello")>),
                                   policy::router([&](bool) {}))));
 
-    auto tokens = std::vector<parsing::token_type>{
+    auto tokens = parsing::token_list{
                     {parsing::prefix_type::long_, "hello"}};
     auto target = m.pre_parse(parsing::pre_parse_data{tokens});
     return 0;
@@ -1368,7 +1457,7 @@ public:
     }
 
     template <typename Validator, bool HasTarget, typename... Parents>
-    [[nodiscard]] std::optional<parsing::parse_target> pre_parse(
+    [[nodiscard]] parsing::pre_parse_target_result pre_parse(
         parsing::pre_parse_data<Validator, HasTarget> pre_parse_data,
         const Parents&... parents) const
     {
@@ -1388,9 +1477,9 @@ int main() {
                                   policy::router([&](bool) {}))));
                              
 
-    auto tokens = std::vector<parsing::token_type>{
+    auto tokens = parsing::token_list{
                     {parsing::prefix_type::long_, "hello"}};
-    auto target = m.pre_parse(parsing::pre_parse_data{tokens});
+    auto target = m.pre_parse(parsing::pre_parse_data{tokens}).extract();
     (*target)();
     return 0;
 }
@@ -1486,7 +1575,7 @@ int main() {
     const auto fake_parent = flag(policy::long_name<AR_STRING("fake")>);
     const auto m = mode(flag(policy::long_name<AR_STRING("hello")>));
 
-    auto tokens = std::vector<parsing::token_type>{
+    auto tokens = parsing::token_list{
                         {parsing::prefix_type::none, "--hello"}};
     auto result = m.pre_parse(parsing::pre_parse_data{
                     tokens,
@@ -33,7 +33,8 @@ BOOST_AUTO_TEST_CASE(policies_test)
 BOOST_AUTO_TEST_CASE(parse_test)
 {
     auto f = [&](auto node, auto tokens, auto expected_result) {
-        auto target = parsing::parse_target{std::move(tokens), node};
+        auto target =
+            parsing::parse_target{parsing::token_buffer(tokens.begin(), tokens.end()), node};
         const auto result = node.parse(std::move(target));
         BOOST_CHECK_EQUAL(result, expected_result);
     };
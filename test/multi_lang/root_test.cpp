@@ -102,6 +102,21 @@ public:
 };
 }  // namespace arg_router::multi_lang
 
+namespace
+{
+[[nodiscard]] std::string join(const std::vector<const char*>& args)
+{
+    auto command_line = std::string{};
+    for (auto arg : args) {
+        if (!command_line.empty()) {
+            command_line += ' ';
+        }
+        command_line += arg;
+    }
+    return command_line;
+}
+}  // namespace
+
 BOOST_AUTO_TEST_SUITE(multi_lang_suite)
 
 BOOST_AUTO_TEST_SUITE(root_suite)
@@ -159,6 +174,26 @@ BOOST_AUTO_TEST_CASE(parse_test)
                          strings.push_back(arg);
                      }
                      r.parse(std::move(strings));
+                 }},
+                {"try_parse int, char** overload",
+                 [&](std::vector<const char*> args) {
+                     r.try_parse(static_cast<int>(args.size()), const_cast<char**>(args.data()))
+                         .throw_exception();
+                 }},
+                {"try_parse Container overload",
+                 [&](std::vector<const char*> args) {  //
+                     args.erase(args.begin());
+                     r.try_parse(args).throw_exception();
+                 }},
+                {"parse_command_line",
+                 [&](std::vector<const char*> args) {
+                     args.erase(args.begin());
+                     r.parse_command_line(join(args));
+                 }},
+                {"try_parse_command_line",
+                 [&](std::vector<const char*> args) {
+                     args.erase(args.begin());
+                     r.try_parse_command_line(join(args)).throw_exception();
                  }}};
 
         for (const auto& [name, invoc] : parse_invocations) {
@@ -0,0 +1,168 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "arg_router/parse_session.hpp"
+#include "arg_router/arg.hpp"
+#include "arg_router/flag.hpp"
+#include "arg_router/mode.hpp"
+#include "arg_router/policy/long_name.hpp"
+#include "arg_router/policy/required.hpp"
+#include "arg_router/policy/router.hpp"
+#include "arg_router/policy/validator.hpp"
+#include "arg_router/root.hpp"
+#include "arg_router/utility/compile_time_string.hpp"
+
+#include "test_helpers.hpp"
+#include "test_printers.hpp"
+
+using namespace arg_router;
+using namespace std::string_view_literals;
+
+namespace
+{
+template <typename Result>
+std::string_view error_string(const Result& result)
+{
+    const auto* e = result.get_error_if();
+    return e ? std::string_view{e->what()} : ""sv;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(parse_session_suite)
+
+BOOST_AUTO_TEST_CASE(incremental_test)
+{
+    auto result = std::optional<std::tuple<bool, int>>{};
+    const auto r = root(mode(flag(policy::long_name<AR_STRING("flag1")>),
+                             arg<int>(policy::long_name<AR_STRING("arg1")>, policy::required),
+                             policy::router{[&](bool flag1, int arg1) {
+                                 result = {flag1, arg1};
+                             }}),
+                        policy::validation::default_validator);
+
+    auto session = parse_session{r};
+    BOOST_CHECK(session.empty());
+    BOOST_CHECK(session.check());
+
+    session.push_back("--flag1");
+    BOOST_CHECK_EQUAL(session.size(), 1);
+    BOOST_CHECK(session.check());
+
+    {
+        // The token strings are owned by the session
+        auto arg = std::string{"--arg1"};
+        session.push_back(arg);
+        arg = "42";
+        session.push_back(arg);
+    }
+    BOOST_CHECK_EQUAL(session.size(), 3);
+    BOOST_CHECK(session.check());
+    BOOST_CHECK(!result);
+
+    // Routing is deferred until finish
+    const auto finish_result = session.finish();
+    BOOST_CHECK_EQUAL(error_string(finish_result), ""sv);
+    BOOST_REQUIRE(result);
+    BOOST_CHECK_EQUAL(std::get<0>(*result), true);
+    BOOST_CHECK_EQUAL(std::get<1>(*result), 42);
+    BOOST_CHECK(session.empty());
+}
+
+BOOST_AUTO_TEST_CASE(incomplete_test)
+{
+    using status = parse_session_status;
+
+    auto result = std::optional<std::tuple<bool, int>>{};
+    const auto r = root(mode(flag(policy::long_name<AR_STRING("flag1")>),
+                             arg<int>(policy::long_name<AR_STRING("arg1")>, policy::required),
+                             policy::router{[&](bool flag1, int arg1) {
+                                 result = {flag1, arg1};
+                             }}),
+                        policy::validation::default_validator);
+
+    auto session = parse_session{r};
+    auto check = [&](auto expected) {
+        const auto& status = session.check();
+        BOOST_CHECK_EQUAL(error_string(status), ""sv);
+        BOOST_REQUIRE(status);
+        BOOST_CHECK(*status.get_if() == expected);
+    };
+
+    session.push_back("--flag1");
+    check(status::complete);
+
+    // The label has arrived but its value has not, which is not an error yet
+    session.push_back("--arg1");
+    check(status::incomplete);
+
+    session.push_back("42");
+    check(status::complete);
+
+    const auto finish_result = session.finish();
+    BOOST_CHECK_EQUAL(error_string(finish_result), ""sv);
+    BOOST_REQUIRE(result);
+    BOOST_CHECK_EQUAL(std::get<0>(*result), true);
+    BOOST_CHECK_EQUAL(std::get<1>(*result), 42);
+}
+
+BOOST_AUTO_TEST_CASE(check_test)
+{
+    auto router_hit = false;
+    const auto r = root(mode(flag(policy::long_name<AR_STRING("flag1")>),
+                             arg<int>(policy::long_name<AR_STRING("arg1")>, policy::required),
+                             policy::router{[&](bool, int) { router_hit = true; }}),
+                        policy::validation::default_validator);
+
+    auto f = [&](auto tokens, auto check_error, auto finish_error) {
+        router_hit = false;
+
+        auto session = parse_session{r};
+        session.append(tokens.begin(), tokens.end());
+        BOOST_CHECK_EQUAL(error_string(session.check()), check_error);
+        BOOST_CHECK(!router_hit);
+
+        BOOST_CHECK_EQUAL(error_string(session.finish()), finish_error);
+        BOOST_CHECK_EQUAL(router_hit, finish_error.empty());
+    };
+
+    test::data_set(
+        f,
+        {
+            std::tuple{std::vector{"--arg1", "13"}, ""sv, ""sv},
+            std::tuple{std::vector{"--flag1"}, ""sv, "Missing required argument: --arg1"sv},
+            std::tuple{std::vector{"--arg1", "foo"}, ""sv, "Failed to parse: foo"sv},
+            std::tuple{std::vector{"--flag1", "--foo"},
+                       "Unknown argument: --foo. Did you mean --flag1?"sv,
+                       "Unknown argument: --foo. Did you mean --flag1?"sv},
+            std::tuple{std::vector{"--flag1", "--flag1"},
+                       "Argument has already been set: --flag1"sv,
+                       "Argument has already been set: --flag1"sv},
+        });
+}
+
+BOOST_AUTO_TEST_CASE(reuse_test)
+{
+    auto results = std::vector<int>{};
+    const auto r = root(mode(arg<int>(policy::long_name<AR_STRING("arg1")>, policy::required),
+                             policy::router{[&](int arg1) { results.push_back(arg1); }}),
+                        policy::validation::default_validator);
+
+    auto session = parse_session{r};
+    for (auto i = 0; i < 3; ++i) {
+        session.push_back("--foo");
+        BOOST_CHECK(!session.check());
+
+        session.clear();
+        BOOST_CHECK(session.empty());
+
+        const auto value = std::to_string(i);
+        session.push_back("--arg1");
+        session.push_back(value);
+        BOOST_CHECK(session.finish());
+    }
+
+    BOOST_CHECK_EQUAL(results, (std::vector{0, 1, 2}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,119 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "arg_router/parsing/config_table.hpp"
+
+#include "test_helpers.hpp"
+#include "test_printers.hpp"
+
+#include <vector>
+
+using namespace arg_router;
+using namespace std::string_literals;
+
+namespace
+{
+using entries_type = std::vector<std::tuple<std::string, std::string, std::string>>;
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(parsing_suite)
+
+BOOST_AUTO_TEST_SUITE(config_table_suite)
+
+BOOST_AUTO_TEST_CASE(index_test)
+{
+    auto f = [](auto input, auto expected) {
+        const auto table = parsing::config_table::index(span<char>{input.data(), input.size()});
+
+        auto result = entries_type{};
+        for (const auto& entry : table.entries()) {
+            result.emplace_back(entry.section, entry.key, entry.value);
+        }
+        BOOST_REQUIRE_EQUAL(result.size(), expected.size());
+        for (auto i = 0u; i < result.size(); ++i) {
+            BOOST_CHECK_EQUAL(std::get<0>(result[i]), std::get<0>(expected[i]));
+            BOOST_CHECK_EQUAL(std::get<1>(result[i]), std::get<1>(expected[i]));
+            BOOST_CHECK_EQUAL(std::get<2>(result[i]), std::get<2>(expected[i]));
+        }
+    };
+
+    test::data_set(
+        f,
+        {
+            std::tuple{""s, entries_type{}},
+            std::tuple{"\n  \n# comment\n"s, entries_type{}},
+            std::tuple{"a=1"s, entries_type{{"", "a", "1"}}},
+            std::tuple{"  a  =  hello world  \r\n"s, entries_type{{"", "a", "hello world"}}},
+            std::tuple{"a = 1 # comment"s, entries_type{{"", "a", "1"}}},
+            std::tuple{"a = '#1 \\n' # comment"s, entries_type{{"", "a", "#1 \\n"}}},
+            std::tuple{"a = \"x \\\"y\\\" \\\\ \\t#\""s, entries_type{{"", "a", "x \"y\" \\ \t#"}}},
+            std::tuple{"a = \"\""s, entries_type{{"", "a", ""}}},
+            std::tuple{"b = 2\na = 1\n"s, entries_type{{"", "a", "1"}, {"", "b", "2"}}},
+            std::tuple{"a = 1\n[copy]\na = 2\n[ move ] # comment\nb = 3\n"s,
+                       entries_type{{"", "a", "1"}, {"copy", "a", "2"}, {"move", "b", "3"}}},
+        });
+}
+
+BOOST_AUTO_TEST_CASE(find_test)
+{
+    auto input = "a = 1\nb = 2\na = 3\n[copy]\na = 4\n"s;
+    const auto table = parsing::config_table::index(span<char>{input.data(), input.size()});
+
+    BOOST_CHECK(table.find("", "a") == "3");
+    BOOST_CHECK(table.find("", "b") == "2");
+    BOOST_CHECK(table.find("copy", "a") == "4");
+    BOOST_CHECK(!table.find("", "c"));
+    BOOST_CHECK(!table.find("copy", "b"));
+    BOOST_CHECK(!table.find("move", "a"));
+    BOOST_CHECK(!parsing::config_table{}.find("", "a"));
+}
+
+BOOST_AUTO_TEST_CASE(index_in_place_test)
+{
+    auto input = "a = plain\nb = \"e\\\\scaped\"\n"s;
+    const auto table = parsing::config_table::index(span<char>{input.data(), input.size()});
+
+    BOOST_REQUIRE_EQUAL(table.entries().size(), 2);
+    for (const auto& entry : table.entries()) {
+        BOOST_CHECK(entry.value.data() >= input.data());
+        BOOST_CHECK((entry.value.data() + entry.value.size()) <= (input.data() + input.size()));
+    }
+    BOOST_CHECK(table.find("", "b") == "e\\scaped");
+}
+
+BOOST_AUTO_TEST_CASE(invalid_line_test)
+{
+    auto f = [](auto input, auto line) {
+        try {
+            [[maybe_unused]] const auto table =
+                parsing::config_table::index(span<char>{input.data(), input.size()});
+            BOOST_CHECK_MESSAGE(false, "Exception expected");
+        } catch (multi_lang_exception& e) {
+            BOOST_CHECK_EQUAL(e.ec(), error_code::invalid_config_line);
+            BOOST_REQUIRE_EQUAL(e.tokens().size(), 1);
+            BOOST_CHECK_EQUAL(e.tokens().front().name, line);
+        }
+    };
+
+    test::data_set(f,
+                   {
+                       std::tuple{"a = 1\nhello\n"s, "hello"},
+                       std::tuple{" = 1"s, "= 1"},
+                       std::tuple{"a ="s, "a ="},
+                       std::tuple{"a = # comment"s, "a = # comment"},
+                       std::tuple{"[copy"s, "[copy"},
+                       std::tuple{"[ ]"s, "[ ]"},
+                       std::tuple{"[copy] x"s, "[copy] x"},
+                       std::tuple{"a = 'x"s, "a = 'x"},
+                       std::tuple{"a = 'x' y"s, "a = 'x' y"},
+                       std::tuple{"a = \"x"s, "a = \"x"},
+                       std::tuple{"a = \"x\\\""s, "a = \"x\\\""},
+                       std::tuple{"a = \"\\q\""s, "a = \"\\q\""},
+                       std::tuple{"a = \"x\" y"s, "a = \"x\" y"},
+                   });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
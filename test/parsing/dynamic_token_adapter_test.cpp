@@ -15,8 +15,8 @@ BOOST_AUTO_TEST_SUITE(dynamic_token_adapter_suite)
 
 BOOST_AUTO_TEST_CASE(empty_test)
 {
-    auto processed = std::vector<parsing::token_type>{};
-    auto unprocessed = std::vector<parsing::token_type>{};
+    auto processed = parsing::token_buffer{};
+    auto unprocessed = parsing::token_list{};
     const auto adapter = parsing::dynamic_token_adapter{processed, unprocessed};
 
     BOOST_CHECK(adapter.empty());
@@ -24,11 +24,11 @@ BOOST_AUTO_TEST_CASE(empty_test)
 
 BOOST_AUTO_TEST_CASE(iterator_ops_test)
 {
-    auto processed = std::vector<parsing::token_type>{};
-    auto unprocessed = std::vector<parsing::token_type>{{parsing::prefix_type::none, "--hello"},
-                                                        {parsing::prefix_type::none, "42"},
-                                                        {parsing::prefix_type::none, "-f"},
-                                                        {parsing::prefix_type::none, "goodbye"}};
+    auto processed = parsing::token_buffer{};
+    auto unprocessed = parsing::token_list{{parsing::prefix_type::none, "--hello"},
+                                           {parsing::prefix_type::none, "42"},
+                                           {parsing::prefix_type::none, "-f"},
+                                           {parsing::prefix_type::none, "goodbye"}};
 
     auto adapter = parsing::dynamic_token_adapter{processed, unprocessed};
     BOOST_CHECK(processed.empty());
@@ -58,6 +58,8 @@ BOOST_AUTO_TEST_CASE(iterator_ops_test)
 
     it.set({parsing::prefix_type::long_, "test"});
     BOOST_CHECK_EQUAL(*it, (parsing::token_type{parsing::prefix_type::long_, "test"}));
+    BOOST_CHECK_EQUAL(unprocessed.size(), 4);
+    adapter.commit();
     BOOST_CHECK_EQUAL(processed,
                       (std::vector<parsing::token_type>{{parsing::prefix_type::none, "--hello"},
                                                         {parsing::prefix_type::long_, "test"}}));
@@ -108,10 +110,10 @@ BOOST_AUTO_TEST_CASE(iterator_ops_test)
 
 BOOST_AUTO_TEST_CASE(partial_start_test)
 {
-    auto processed = std::vector<parsing::token_type>{{parsing::prefix_type::none, "--hello"},
+    auto processed = parsing::token_buffer{{parsing::prefix_type::none, "--hello"},
                                                       {parsing::prefix_type::none, "42"}};
-    auto unprocessed = std::vector<parsing::token_type>{{parsing::prefix_type::none, "-f"},
-                                                        {parsing::prefix_type::none, "goodbye"}};
+    auto unprocessed = parsing::token_list{{parsing::prefix_type::none, "-f"},
+                                           {parsing::prefix_type::none, "goodbye"}};
 
     auto adapter = parsing::dynamic_token_adapter{processed, unprocessed};
     BOOST_CHECK_EQUAL(processed.size(), 2);
@@ -125,6 +127,7 @@ BOOST_AUTO_TEST_CASE(partial_start_test)
 
     it += 2;
     it.set({parsing::prefix_type::long_, "test"});
+    adapter.commit();
     BOOST_CHECK_EQUAL(processed,
                       (std::vector<parsing::token_type>{{parsing::prefix_type::none, "--hello"},
                                                         {parsing::prefix_type::none, "42"},
@@ -137,11 +140,11 @@ BOOST_AUTO_TEST_CASE(partial_start_test)
 
 BOOST_AUTO_TEST_CASE(end_iterator_test)
 {
-    auto processed = std::vector<parsing::token_type>{};
-    auto unprocessed = std::vector<parsing::token_type>{{parsing::prefix_type::none, "--hello"},
-                                                        {parsing::prefix_type::none, "42"},
-                                                        {parsing::prefix_type::none, "-f"},
-                                                        {parsing::prefix_type::none, "goodbye"}};
+    auto processed = parsing::token_buffer{};
+    auto unprocessed = parsing::token_list{{parsing::prefix_type::none, "--hello"},
+                                           {parsing::prefix_type::none, "42"},
+                                           {parsing::prefix_type::none, "-f"},
+                                           {parsing::prefix_type::none, "goodbye"}};
 
     auto adapter = parsing::dynamic_token_adapter{processed, unprocessed};
 
@@ -171,11 +174,11 @@ BOOST_AUTO_TEST_CASE(end_iterator_test)
 
 BOOST_AUTO_TEST_CASE(loop_test)
 {
-    auto processed = std::vector<parsing::token_type>{};
-    auto unprocessed = std::vector<parsing::token_type>{{parsing::prefix_type::none, "--hello"},
-                                                        {parsing::prefix_type::none, "42"},
-                                                        {parsing::prefix_type::none, "-f"},
-                                                        {parsing::prefix_type::none, "goodbye"}};
+    auto processed = parsing::token_buffer{};
+    auto unprocessed = parsing::token_list{{parsing::prefix_type::none, "--hello"},
+                                           {parsing::prefix_type::none, "42"},
+                                           {parsing::prefix_type::none, "-f"},
+                                           {parsing::prefix_type::none, "goodbye"}};
 
     auto adapter = parsing::dynamic_token_adapter{processed, unprocessed};
 
@@ -189,17 +192,18 @@ BOOST_AUTO_TEST_CASE(loop_test)
 
 BOOST_AUTO_TEST_CASE(insertion_test)
 {
-    auto processed = std::vector<parsing::token_type>{};
-    auto unprocessed = std::vector<parsing::token_type>{{parsing::prefix_type::none, "--hello"},
-                                                        {parsing::prefix_type::none, "42"},
-                                                        {parsing::prefix_type::none, "-f"},
-                                                        {parsing::prefix_type::none, "goodbye"}};
+    auto processed = parsing::token_buffer{};
+    auto unprocessed = parsing::token_list{{parsing::prefix_type::none, "--hello"},
+                                           {parsing::prefix_type::none, "42"},
+                                           {parsing::prefix_type::none, "-f"},
+                                           {parsing::prefix_type::none, "goodbye"}};
 
     auto adapter = parsing::dynamic_token_adapter{processed, unprocessed};
     auto it = adapter.begin() + 2;
 
     auto result = adapter.insert(it, (parsing::token_type{parsing::prefix_type::long_, "foo"}));
     BOOST_CHECK(it == result);
+    adapter.commit();
     BOOST_CHECK_EQUAL(processed,
                       (std::vector<parsing::token_type>{{parsing::prefix_type::none, "--hello"},
                                                         {parsing::prefix_type::none, "42"},
@@ -210,6 +214,7 @@ BOOST_AUTO_TEST_CASE(insertion_test)
 
     it = adapter.end();
     adapter.insert(it, (parsing::token_type{parsing::prefix_type::long_, "bar"}));
+    adapter.commit();
     BOOST_CHECK_EQUAL(processed,
                       (std::vector<parsing::token_type>{{parsing::prefix_type::none, "--hello"},
                                                         {parsing::prefix_type::none, "42"},
@@ -222,16 +227,17 @@ BOOST_AUTO_TEST_CASE(insertion_test)
 
 BOOST_AUTO_TEST_CASE(erase_test)
 {
-    auto processed = std::vector<parsing::token_type>{};
-    auto unprocessed = std::vector<parsing::token_type>{{parsing::prefix_type::none, "--hello"},
-                                                        {parsing::prefix_type::none, "42"},
-                                                        {parsing::prefix_type::none, "-f"},
-                                                        {parsing::prefix_type::none, "goodbye"}};
+    auto processed = parsing::token_buffer{};
+    auto unprocessed = parsing::token_list{{parsing::prefix_type::none, "--hello"},
+                                           {parsing::prefix_type::none, "42"},
+                                           {parsing::prefix_type::none, "-f"},
+                                           {parsing::prefix_type::none, "goodbye"}};
 
     auto adapter = parsing::dynamic_token_adapter{processed, unprocessed};
 
     auto it = adapter.begin() + 2;
     adapter.erase(it);
+    adapter.commit();
     BOOST_CHECK(processed.empty());
     BOOST_CHECK_EQUAL(unprocessed,
                       (std::vector<parsing::token_type>{{parsing::prefix_type::none, "--hello"},
@@ -239,7 +245,8 @@ BOOST_AUTO_TEST_CASE(erase_test)
                                                         {parsing::prefix_type::none, "goodbye"}}));
     BOOST_CHECK_EQUAL(*it, (parsing::token_type{parsing::prefix_type::none, "goodbye"}));
 
-    std::swap(processed, unprocessed);
+    processed.assign(unprocessed.begin(), unprocessed.end());
+    unprocessed.clear();
     adapter.erase(it);
     BOOST_CHECK(unprocessed.empty());
     BOOST_CHECK_EQUAL(processed,
@@ -256,15 +263,102 @@ BOOST_AUTO_TEST_CASE(erase_test)
     BOOST_CHECK(it == adapter.end());
 }
 
+BOOST_AUTO_TEST_CASE(insert_unprocessed_test)
+{
+    auto processed = parsing::token_buffer{};
+    auto unprocessed = parsing::token_list{{parsing::prefix_type::none, "-abc"},
+                                           {parsing::prefix_type::none, "42"}};
+
+    auto adapter = parsing::dynamic_token_adapter{processed, unprocessed};
+    adapter.transfer(adapter.begin());
+    adapter.insert_unprocessed(0, {parsing::prefix_type::short_, "b"});
+    adapter.insert_unprocessed(1, {parsing::prefix_type::short_, "c"});
+    adapter.begin().set({parsing::prefix_type::short_, "a"});
+
+    BOOST_CHECK_EQUAL(adapter.size(), 4);
+    BOOST_CHECK_EQUAL(adapter.unprocessed_size(), 3);
+    BOOST_CHECK_EQUAL(adapter.begin()[1], (parsing::token_type{parsing::prefix_type::short_, "b"}));
+    BOOST_CHECK_EQUAL(adapter.begin()[2], (parsing::token_type{parsing::prefix_type::short_, "c"}));
+    BOOST_CHECK_EQUAL(adapter.begin()[3], (parsing::token_type{parsing::prefix_type::none, "42"}));
+    BOOST_CHECK_EQUAL(unprocessed,
+                      (std::vector<parsing::token_type>{{parsing::prefix_type::none, "-abc"},
+                                                        {parsing::prefix_type::none, "42"}}));
+
+    adapter.commit();
+    BOOST_CHECK_EQUAL(processed,
+                      (std::vector<parsing::token_type>{{parsing::prefix_type::short_, "a"}}));
+    BOOST_CHECK_EQUAL(unprocessed,
+                      (std::vector<parsing::token_type>{{parsing::prefix_type::short_, "b"},
+                                                        {parsing::prefix_type::short_, "c"},
+                                                        {parsing::prefix_type::none, "42"}}));
+}
+
+BOOST_AUTO_TEST_CASE(insert_unprocessed_range_test)
+{
+    auto processed = parsing::token_buffer{};
+    auto unprocessed = parsing::token_list{{parsing::prefix_type::none, "-abc"},
+                                           {parsing::prefix_type::none, "42"}};
+    const auto extra = std::vector<parsing::token_type>{{parsing::prefix_type::short_, "b"},
+                                                        {parsing::prefix_type::short_, "c"}};
+
+    auto adapter = parsing::dynamic_token_adapter{processed, unprocessed};
+    adapter.transfer(adapter.begin());
+    adapter.insert_unprocessed(0, extra.begin(), extra.end());
+    adapter.begin().set({parsing::prefix_type::short_, "a"});
+
+    BOOST_CHECK_EQUAL(adapter.size(), 4);
+    BOOST_CHECK_EQUAL(adapter.unprocessed_size(), 3);
+    BOOST_CHECK_EQUAL(adapter.begin()[1], (parsing::token_type{parsing::prefix_type::short_, "b"}));
+    BOOST_CHECK_EQUAL(adapter.begin()[2], (parsing::token_type{parsing::prefix_type::short_, "c"}));
+    BOOST_CHECK_EQUAL(adapter.begin()[3], (parsing::token_type{parsing::prefix_type::none, "42"}));
+
+    adapter.commit();
+    BOOST_CHECK_EQUAL(processed,
+                      (std::vector<parsing::token_type>{{parsing::prefix_type::short_, "a"}}));
+    BOOST_CHECK_EQUAL(unprocessed,
+                      (std::vector<parsing::token_type>{{parsing::prefix_type::short_, "b"},
+                                                        {parsing::prefix_type::short_, "c"},
+                                                        {parsing::prefix_type::none, "42"}}));
+}
+
+BOOST_AUTO_TEST_CASE(rollback_test)
+{
+    auto processed = parsing::token_buffer{};
+    auto unprocessed = parsing::token_list{{parsing::prefix_type::none, "--hello"},
+                                           {parsing::prefix_type::none, "42"},
+                                           {parsing::prefix_type::none, "-f"},
+                                           {parsing::prefix_type::none, "goodbye"}};
+    const auto expected_unprocessed = unprocessed;
+
+    {
+        auto adapter = parsing::dynamic_token_adapter{processed, unprocessed};
+        adapter.transfer(adapter.begin() + 1);
+        adapter.erase(adapter.begin() + 3);
+        adapter.insert_unprocessed(0, {parsing::prefix_type::short_, "g"});
+
+        BOOST_CHECK_EQUAL(adapter.size(), 4);
+        BOOST_CHECK_EQUAL(adapter.begin()[2],
+                          (parsing::token_type{parsing::prefix_type::short_, "g"}));
+        BOOST_CHECK_EQUAL(adapter.begin()[3],
+                          (parsing::token_type{parsing::prefix_type::none, "-f"}));
+    }
+
+    // The adapter was not committed, so the unprocessed tokens are untouched
+    BOOST_CHECK_EQUAL(unprocessed, expected_unprocessed);
+}
+
 BOOST_AUTO_TEST_CASE(transfer_test)
 {
-    auto f = [](auto processed,
-                auto unprocessed,
+    auto f = [](auto initial_processed,
+                parsing::token_list unprocessed,
                 auto offset,
                 auto expected_processed,
                 auto expected_unprocessed) {
+        auto processed =
+            parsing::token_buffer(initial_processed.begin(), initial_processed.end());
         auto adapter = parsing::dynamic_token_adapter{processed, unprocessed};
         adapter.transfer(adapter.begin() + offset);
+        adapter.commit();
         BOOST_CHECK_EQUAL(processed, expected_processed);
         BOOST_CHECK_EQUAL(unprocessed, expected_unprocessed);
     };
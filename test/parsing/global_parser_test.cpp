@@ -1,4 +1,4 @@
-// Copyright (C) 2022 by Camden Mannett.
+// Copyright (C) 2022-2023 by Camden Mannett.
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
 
@@ -48,6 +48,58 @@ BOOST_AUTO_TEST_CASE(numeric_parse_test)
                        std::uint8_t{0},
                        std::optional<multi_lang_exception>{
                            test::create_exception(error_code::failed_to_parse, {"23742949"})}},
+            std::tuple{"4000000000", 4000000000u, std::optional<multi_lang_exception>{}},
+            std::tuple{"-9223372036854775807",
+                       std::int64_t{-9223372036854775807},
+                       std::optional<multi_lang_exception>{}},
+            std::tuple{"1e3", 1000.0, std::optional<multi_lang_exception>{}},
+            std::tuple{"-2.5e-3", -0.0025, std::optional<multi_lang_exception>{}},
+            std::tuple{"",
+                       42,
+                       std::optional<multi_lang_exception>{
+                           test::create_exception(error_code::failed_to_parse, {""})}},
+            std::tuple{"+",
+                       42,
+                       std::optional<multi_lang_exception>{
+                           test::create_exception(error_code::failed_to_parse, {"+"})}},
+            std::tuple{"++42",
+                       42,
+                       std::optional<multi_lang_exception>{
+                           test::create_exception(error_code::failed_to_parse, {"++42"})}},
+            std::tuple{"+-42",
+                       42,
+                       std::optional<multi_lang_exception>{
+                           test::create_exception(error_code::failed_to_parse, {"+-42"})}},
+            std::tuple{"42abc",
+                       42,
+                       std::optional<multi_lang_exception>{
+                           test::create_exception(error_code::failed_to_parse, {"42abc"})}},
+            std::tuple{" 42",
+                       42,
+                       std::optional<multi_lang_exception>{
+                           test::create_exception(error_code::failed_to_parse, {" 42"})}},
+            std::tuple{"3.14",
+                       42,
+                       std::optional<multi_lang_exception>{
+                           test::create_exception(error_code::failed_to_parse, {"3.14"})}},
+            std::tuple{"3.14.1",
+                       3.14,
+                       std::optional<multi_lang_exception>{
+                           test::create_exception(error_code::failed_to_parse, {"3.14.1"})}},
+            std::tuple{"-1",
+                       42u,
+                       // create_exception would treat this as a short name token
+                       std::optional<multi_lang_exception>{multi_lang_exception{
+                           error_code::failed_to_parse,
+                           parsing::token_type{parsing::prefix_type::none, "-1"}}}},
+            std::tuple{"300",
+                       std::int8_t{0},
+                       std::optional<multi_lang_exception>{
+                           test::create_exception(error_code::failed_to_parse, {"300"})}},
+            std::tuple{"99999999999999999999",
+                       std::int64_t{0},
+                       std::optional<multi_lang_exception>{test::create_exception(
+                           error_code::failed_to_parse, {"99999999999999999999"})}},
         });
 }
 
@@ -0,0 +1,134 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "arg_router/parsing/name_dispatch_table.hpp"
+#include "arg_router/arg.hpp"
+#include "arg_router/flag.hpp"
+#include "arg_router/forwarding_arg.hpp"
+#include "arg_router/policy/display_name.hpp"
+#include "arg_router/policy/long_name.hpp"
+#include "arg_router/policy/none_name.hpp"
+#include "arg_router/policy/runtime_enable.hpp"
+#include "arg_router/policy/short_name.hpp"
+#include "arg_router/policy/value_separator.hpp"
+#include "arg_router/positional_arg.hpp"
+#include "arg_router/utility/compile_time_string.hpp"
+
+#include "test_helpers.hpp"
+#include "test_printers.hpp"
+
+using namespace arg_router;
+
+namespace
+{
+using children_type = std::tuple<
+    std::decay_t<decltype(flag(policy::long_name<AR_STRING("hello")>,
+                               policy::short_name<'H'>))>,
+    std::decay_t<decltype(flag(policy::short_name<'a'>))>,
+    std::decay_t<decltype(arg<int>(policy::long_name<AR_STRING("arg")>,
+                                   policy::value_separator<'='>))>,
+    std::decay_t<decltype(arg<int>(policy::long_name<AR_STRING("zed")>,
+                                   policy::runtime_enable{true}))>,
+    std::decay_t<decltype(positional_arg<std::vector<int>>(
+        policy::display_name<AR_STRING("pos")>))>,
+    std::decay_t<decltype(forwarding_arg(policy::none_name<AR_STRING("--")>))>,
+    std::decay_t<decltype(flag(policy::long_name<AR_STRING("hello")>))>>;
+
+using table_type = parsing::name_dispatch_table<children_type>;
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(parsing_suite)
+
+BOOST_AUTO_TEST_SUITE(name_dispatch_table_suite)
+
+BOOST_AUTO_TEST_CASE(is_dispatchable_test)
+{
+    static_assert(table_type::num_children == 7);
+
+    static_assert(table_type::is_dispatchable<0>, "Plain flag should be dispatchable");
+    static_assert(table_type::is_dispatchable<1>, "Short form expander supports dispatch");
+    static_assert(!table_type::is_dispatchable<2>, "Value separator rewrites the label");
+    static_assert(table_type::is_dispatchable<3>, "Runtime enable preserves the label");
+    static_assert(!table_type::is_dispatchable<4>, "Positional args are not named");
+    static_assert(table_type::is_dispatchable<5>, "None named node should be dispatchable");
+    static_assert(table_type::is_dispatchable<6>, "Duplicate names are not rejected");
+}
+
+BOOST_AUTO_TEST_CASE(find_test)
+{
+    auto f = [](auto token, auto expected) {
+        const auto result = table_type::find(token);
+        BOOST_CHECK_EQUAL(result.to_string(), expected);
+    };
+
+    // Index zero is the rightmost bit
+    test::data_set(f,
+                   {
+                       std::tuple{parsing::token_type{parsing::prefix_type::long_, "hello"},
+                                  "1000001"},
+                       std::tuple{parsing::token_type{parsing::prefix_type::none, "--hello"},
+                                  "1000001"},
+                       std::tuple{parsing::token_type{parsing::prefix_type::short_, "H"},
+                                  "0000001"},
+                       std::tuple{parsing::token_type{parsing::prefix_type::none, "-H"},
+                                  "0000001"},
+                       std::tuple{parsing::token_type{parsing::prefix_type::long_, "H"},
+                                  "0000000"},
+                       std::tuple{parsing::token_type{parsing::prefix_type::short_, "hello"},
+                                  "0000000"},
+                       std::tuple{parsing::token_type{parsing::prefix_type::none, "--zed"},
+                                  "0001000"},
+                       std::tuple{parsing::token_type{parsing::prefix_type::none, "--"},
+                                  "0100000"},
+                       std::tuple{parsing::token_type{parsing::prefix_type::long_, ""},
+                                  "0000000"},
+                       std::tuple{parsing::token_type{parsing::prefix_type::none, "--arg"},
+                                  "0000000"},
+                       std::tuple{parsing::token_type{parsing::prefix_type::none, "--arg=42"},
+                                  "0000000"},
+                       std::tuple{parsing::token_type{parsing::prefix_type::none, "-a"},
+                                  "0000010"},
+                       std::tuple{parsing::token_type{parsing::prefix_type::none, "-aH"},
+                                  "0000010"},
+                       std::tuple{parsing::token_type{parsing::prefix_type::short_, "Ha"},
+                                  "0000001"},
+                       std::tuple{parsing::token_type{parsing::prefix_type::long_, "ahello"},
+                                  "0000000"},
+                       std::tuple{parsing::token_type{parsing::prefix_type::none, "42"},
+                                  "0000000"},
+                       std::tuple{parsing::token_type{parsing::prefix_type::none, ""},
+                                  "0000000"},
+                   });
+}
+
+BOOST_AUTO_TEST_CASE(find_first_test)
+{
+    auto f = [](auto token, auto expected) {
+        const auto result = table_type::find_first(token);
+        BOOST_CHECK_EQUAL(result, expected);
+    };
+
+    test::data_set(f,
+                   {
+                       std::tuple{parsing::token_type{parsing::prefix_type::long_, "hello"}, 0u},
+                       std::tuple{parsing::token_type{parsing::prefix_type::none, "-aH"}, 1u},
+                       std::tuple{parsing::token_type{parsing::prefix_type::none, "--zed"}, 3u},
+                       std::tuple{parsing::token_type{parsing::prefix_type::none, "--"}, 5u},
+                       std::tuple{parsing::token_type{parsing::prefix_type::none, "42"}, 7u},
+                   });
+}
+
+BOOST_AUTO_TEST_CASE(empty_test)
+{
+    using empty_table_type = parsing::name_dispatch_table<std::tuple<>>;
+    static_assert(empty_table_type::num_children == 0);
+
+    const auto result = empty_table_type::find({parsing::prefix_type::long_, "hello"});
+    BOOST_CHECK(result.none());
+    BOOST_CHECK_EQUAL(empty_table_type::find_first({parsing::prefix_type::long_, "hello"}), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
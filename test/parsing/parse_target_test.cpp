@@ -74,7 +74,9 @@ BOOST_AUTO_TEST_CASE(accessors_test)
     auto f = [](auto expected_tokens) {
         const auto node = stub_node{};
         const auto expected_index = utility::type_hash<std::decay_t<decltype(node)>>();
-        auto target = parsing::parse_target{expected_tokens, node};
+        auto target = parsing::parse_target{
+            parsing::token_buffer(expected_tokens.begin(), expected_tokens.end()),
+            node};
 
         BOOST_CHECK(target);
         BOOST_CHECK_EQUAL(expected_tokens, target.tokens());
@@ -91,9 +93,38 @@ BOOST_AUTO_TEST_CASE(accessors_test)
         });
 }
 
+BOOST_AUTO_TEST_CASE(flatten_sub_target_test)
+{
+    const auto node1 = stub_node{};
+    const auto node2 = stub_node{stub_node{}};
+    const auto node3 = stub_node{stub_node{}, stub_node{}};
+
+    auto target = parsing::parse_target{node1};
+    target.reserve_sub_targets(3);
+
+    target.flatten_sub_target(parsing::parse_target{node2});
+    BOOST_REQUIRE_EQUAL(target.sub_targets().size(), 1);
+    BOOST_CHECK_EQUAL(target.sub_targets()[0].node_type(),
+                      utility::type_hash<std::decay_t<decltype(node2)>>());
+
+    auto nested = parsing::parse_target{node1};
+    nested.add_sub_target(parsing::parse_target{node3});
+    nested.add_sub_target(parsing::parse_target{node2});
+    target.flatten_sub_target(std::move(nested));
+
+    BOOST_REQUIRE_EQUAL(target.sub_targets().size(), 3);
+    BOOST_CHECK_EQUAL(target.sub_targets()[1].node_type(),
+                      utility::type_hash<std::decay_t<decltype(node3)>>());
+    BOOST_CHECK_EQUAL(target.sub_targets()[2].node_type(),
+                      utility::type_hash<std::decay_t<decltype(node2)>>());
+    for (const auto& sub_target : target.sub_targets()) {
+        BOOST_CHECK(sub_target);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(function_test)
 {
-    auto tokens = std::vector<parsing::token_type>{{parsing::prefix_type::none, "hello"}};
+    auto tokens = parsing::token_buffer{{parsing::prefix_type::none, "hello"}};
     auto root = stub_node{stub_node{},            //
                           stub_node{stub_node{},  //
                                     stub_node{}}};
@@ -39,7 +39,7 @@ public:
     }
 
     template <typename Validator, bool HasTarget, typename... Parents>
-    [[nodiscard]] std::optional<parsing::parse_target> pre_parse(
+    [[nodiscard]] parsing::pre_parse_target_result pre_parse(
         parsing::pre_parse_data<Validator, HasTarget> pre_parse_data,
         const Parents&... parents) const
 
@@ -128,6 +128,46 @@ BOOST_AUTO_TEST_CASE(match_test)
             parsing::match<std::decay_t<decltype(a)>>({parsing::prefix_type::long_, "arg"});
         BOOST_CHECK(result);
     }
+
+    {
+        [[maybe_unused]] const auto f =
+            flag(policy::long_name<AR_STRING("output-format")>, policy::short_name<'o'>);
+        using flag_type = std::decay_t<decltype(f)>;
+
+        BOOST_CHECK(parsing::match<flag_type>(
+            parsing::get_token_type(f, parsing::classify("--output-format"))));
+        BOOST_CHECK(
+            parsing::match<flag_type>(parsing::get_token_type(f, parsing::classify("-o"))));
+        BOOST_CHECK(!parsing::match<flag_type>(
+            parsing::get_token_type(f, parsing::classify("--output-file"))));
+        BOOST_CHECK(!parsing::match<flag_type>(parsing::classify("--output-format")));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(name_hash_test)
+{
+    static_assert(parsing::hash_name("hello") == parsing::hash_name("hello"));
+    static_assert(parsing::hash_name("hello") != parsing::hash_name("hellp"));
+    static_assert(parsing::hash_name("") != parsing::hash_name("a"));
+
+    auto f = [](auto token, auto expected_hash) {
+        BOOST_CHECK(!(parsing::token_type{parsing::prefix_type::none, token}.name_hash()));
+
+        const auto classified = parsing::classify(token);
+        BOOST_CHECK_EQUAL(classified.name_hash().has_value(),
+                          classified.classification == parsing::prefix_type::none);
+
+        const auto processed = parsing::get_token_type(classified);
+        BOOST_REQUIRE(processed.name_hash());
+        BOOST_CHECK_EQUAL(*processed.name_hash(), expected_hash);
+    };
+
+    test::data_set(f,
+                   {
+                       std::tuple{"--hello", parsing::hash_name("hello")},
+                       std::tuple{"-h", parsing::hash_name("h")},
+                       std::tuple{"hello", parsing::hash_name("hello")},
+                   });
 }
 
 BOOST_AUTO_TEST_CASE(get_token_type_test)
@@ -135,6 +175,13 @@ BOOST_AUTO_TEST_CASE(get_token_type_test)
     auto f = [](auto token, auto expected_token) {
         const auto result = parsing::get_token_type(token);
         BOOST_CHECK_EQUAL(result, expected_token);
+
+        // The cached classification must give the same result
+        const auto classified = parsing::classify(token);
+        BOOST_CHECK_EQUAL(classified, (parsing::token_type{parsing::prefix_type::none, token}));
+        BOOST_REQUIRE(classified.classification);
+        BOOST_CHECK_EQUAL(*classified.classification, expected_token.prefix);
+        BOOST_CHECK_EQUAL(parsing::get_token_type(classified), expected_token);
     };
 
     test::data_set(
@@ -150,6 +197,12 @@ BOOST_AUTO_TEST_CASE(get_token_type_test_with_node)
     auto f = [](auto node, auto token, auto expected_token) {
         const auto result = parsing::get_token_type(node, token);
         BOOST_CHECK_EQUAL(result, expected_token);
+
+        // The cached classification must give the same result, as must an unclassified token
+        BOOST_CHECK_EQUAL(parsing::get_token_type(node, parsing::classify(token)), expected_token);
+        BOOST_CHECK_EQUAL(
+            parsing::get_token_type(node, parsing::token_type{parsing::prefix_type::none, token}),
+            expected_token);
     };
 
     test::data_set(f,
@@ -172,6 +225,17 @@ BOOST_AUTO_TEST_CASE(get_token_type_test_with_node)
                        std::tuple{stub_node{},
                                   "--hello",
                                   parsing::token_type{parsing::prefix_type::none, "--hello"}},
+                       std::tuple{stub_node{policy::short_name<'h'>},
+                                  "--hello",
+                                  parsing::token_type{parsing::prefix_type::none, "--hello"}},
+                       std::tuple{stub_node{policy::long_name<AR_STRING("hello")>,
+                                            policy::short_name<'h'>},
+                                  "-h",
+                                  parsing::token_type{parsing::prefix_type::short_, "h"}},
+                       std::tuple{stub_node{policy::long_name<AR_STRING("hello")>,
+                                            policy::short_name<'h'>},
+                                  "--hello",
+                                  parsing::token_type{parsing::prefix_type::long_, "hello"}},
                    });
 }
 
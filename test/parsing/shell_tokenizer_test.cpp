@@ -0,0 +1,218 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "arg_router/parsing/shell_tokenizer.hpp"
+
+#include "test_helpers.hpp"
+#include "test_printers.hpp"
+
+#include <vector>
+
+using namespace arg_router;
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+BOOST_AUTO_TEST_SUITE(parsing_suite)
+
+BOOST_AUTO_TEST_SUITE(shell_tokenizer_suite)
+
+BOOST_AUTO_TEST_CASE(shell_split_in_place_test)
+{
+    auto f = [](auto input, auto expected) {
+        auto buffer = std::vector<char>(input.begin(), input.end());
+        auto result = std::vector<std::string>{};
+        parsing::shell_split_in_place(span<char>{buffer.data(), buffer.size()},
+                                      [&](auto token) { result.emplace_back(token); });
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(result.begin(),
+                                      result.end(),
+                                      expected.begin(),
+                                      expected.end());
+    };
+
+    test::data_set(
+        f,
+        {
+            std::tuple{""s, std::vector<std::string>{}},
+            std::tuple{" \t\n "s, std::vector<std::string>{}},
+            std::tuple{"hello"s, std::vector<std::string>{"hello"}},
+            std::tuple{"  hello   world  "s, std::vector<std::string>{"hello", "world"}},
+            std::tuple{"--flag\n-a 42\r\n"s, std::vector<std::string>{"--flag", "-a", "42"}},
+            std::tuple{"'hello world'"s, std::vector<std::string>{"hello world"}},
+            std::tuple{"\"hello world\""s, std::vector<std::string>{"hello world"}},
+            std::tuple{"''"s, std::vector<std::string>{""}},
+            std::tuple{"--arg='a b' c"s, std::vector<std::string>{"--arg=a b", "c"}},
+            std::tuple{"a'b'\"c\"d"s, std::vector<std::string>{"abcd"}},
+            std::tuple{"hello\\ world"s, std::vector<std::string>{"hello world"}},
+            std::tuple{"'a\\b'"s, std::vector<std::string>{"a\\b"}},
+            std::tuple{"\"a\\\"b\\\\c\\d\""s, std::vector<std::string>{"a\"b\\c\\d"}},
+            std::tuple{"\"it's\""s, std::vector<std::string>{"it's"}},
+            std::tuple{"a\\\nb c"s, std::vector<std::string>{"ab", "c"}},
+            std::tuple{"\"a\\\nb\""s, std::vector<std::string>{"ab"}},
+            std::tuple{"a\\"s, std::vector<std::string>{"a"}},
+        });
+}
+
+BOOST_AUTO_TEST_CASE(shell_split_in_place_views_buffer_test)
+{
+    auto buffer = "plain 'quo ted' last"s;
+    const auto original = buffer;
+
+    auto result = std::vector<std::string_view>{};
+    parsing::shell_split_in_place(span<char>{buffer.data(), buffer.size()},
+                                  [&](auto token) { result.push_back(token); });
+
+    BOOST_REQUIRE_EQUAL(result.size(), 3);
+    BOOST_CHECK_EQUAL(result[0], "plain");
+    BOOST_CHECK_EQUAL(result[1], "quo ted");
+    BOOST_CHECK_EQUAL(result[2], "last");
+
+    // All the tokens view the buffer
+    for (auto token : result) {
+        BOOST_CHECK(token.data() >= buffer.data());
+        BOOST_CHECK((token.data() + token.size()) <= (buffer.data() + buffer.size()));
+    }
+
+    // Tokens without quotes or escapes are left untouched
+    BOOST_CHECK_EQUAL(buffer.substr(0, 6), original.substr(0, 6));
+    BOOST_CHECK_EQUAL(buffer.substr(16), original.substr(16));
+}
+
+BOOST_AUTO_TEST_CASE(shell_split_in_place_unterminated_quote_test)
+{
+    auto f = [](auto input) {
+        auto buffer = std::vector<char>(input.begin(), input.end());
+        try {
+            parsing::shell_split_in_place(span<char>{buffer.data(), buffer.size()},
+                                          [](auto) {});
+            BOOST_CHECK_MESSAGE(false, "Exception expected");
+        } catch (multi_lang_exception& e) {
+            BOOST_CHECK_EQUAL(e.ec(), error_code::unterminated_quote);
+        }
+    };
+
+    test::data_set(f,
+                   {
+                       std::tuple{"'hello"s},
+                       std::tuple{"\"hello"s},
+                       std::tuple{"a \"b\\\""s},
+                       std::tuple{"ok 'it''s"s},
+                   });
+}
+
+BOOST_AUTO_TEST_CASE(shell_split_test)
+{
+    auto f = [](auto input, auto expected) {
+        auto arena = string{};
+        auto result = std::vector<std::string>{};
+        parsing::shell_split(input, arena, [&](auto token) { result.emplace_back(token); });
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(result.begin(),
+                                      result.end(),
+                                      expected.begin(),
+                                      expected.end());
+    };
+
+    test::data_set(
+        f,
+        {
+            std::tuple{""s, std::vector<std::string>{}},
+            std::tuple{" \t\n "s, std::vector<std::string>{}},
+            std::tuple{"hello"s, std::vector<std::string>{"hello"}},
+            std::tuple{"  hello   world  "s, std::vector<std::string>{"hello", "world"}},
+            std::tuple{"--flag\n-a 42\r\n"s, std::vector<std::string>{"--flag", "-a", "42"}},
+            std::tuple{"'hello world'"s, std::vector<std::string>{"hello world"}},
+            std::tuple{"\"hello world\""s, std::vector<std::string>{"hello world"}},
+            std::tuple{"''"s, std::vector<std::string>{""}},
+            std::tuple{"--arg='a b' c"s, std::vector<std::string>{"--arg=a b", "c"}},
+            std::tuple{"a'b'\"c\"d"s, std::vector<std::string>{"abcd"}},
+            std::tuple{"hello\\ world"s, std::vector<std::string>{"hello world"}},
+            std::tuple{"'a\\b'"s, std::vector<std::string>{"a\\b"}},
+            std::tuple{"\"a\\\"b\\\\c\\d\""s, std::vector<std::string>{"a\"b\\c\\d"}},
+            std::tuple{"\"it's\""s, std::vector<std::string>{"it's"}},
+            std::tuple{"a\\\nb c"s, std::vector<std::string>{"ab", "c"}},
+            std::tuple{"\"a\\\nb\""s, std::vector<std::string>{"ab"}},
+            std::tuple{"a\\"s, std::vector<std::string>{"a"}},
+            std::tuple{"x 'a b' y \"c d\" z"s,
+                       std::vector<std::string>{"x", "a b", "y", "c d", "z"}},
+        });
+}
+
+BOOST_AUTO_TEST_CASE(shell_split_views_input_test)
+{
+    const auto input = "plain 'quo ted' mid\\dle last"s;
+    auto arena = string{};
+
+    auto result = std::vector<std::string_view>{};
+    parsing::shell_split(input, arena, [&](auto token) { result.push_back(token); });
+
+    BOOST_REQUIRE_EQUAL(result.size(), 4);
+    BOOST_CHECK_EQUAL(result[0], "plain");
+    BOOST_CHECK_EQUAL(result[1], "quo ted");
+    BOOST_CHECK_EQUAL(result[2], "middle");
+    BOOST_CHECK_EQUAL(result[3], "last");
+
+    // Plain tokens view the input, the others view the arena which is only sized once
+    BOOST_CHECK(result[0].data() == input.data());
+    BOOST_CHECK(result[3].data() == (input.data() + 24));
+    BOOST_CHECK(result[1].data() == arena.data());
+    BOOST_CHECK(result[2].data() == (arena.data() + 7));
+    BOOST_CHECK_EQUAL(arena.size(), input.size());
+
+    // No arena is needed if there are no quotes or escapes
+    arena.clear();
+    arena.shrink_to_fit();
+    parsing::shell_split("a b c"sv, arena, [](auto) {});
+    BOOST_CHECK(arena.empty());
+}
+
+BOOST_AUTO_TEST_CASE(shell_split_unterminated_quote_test)
+{
+    auto f = [](auto input) {
+        auto arena = string{};
+        try {
+            parsing::shell_split(input, arena, [](auto) {});
+            BOOST_CHECK_MESSAGE(false, "Exception expected");
+        } catch (multi_lang_exception& e) {
+            BOOST_CHECK_EQUAL(e.ec(), error_code::unterminated_quote);
+        }
+    };
+
+    test::data_set(f,
+                   {
+                       std::tuple{"'hello"s},
+                       std::tuple{"\"hello"s},
+                       std::tuple{"a \"b\\\""s},
+                       std::tuple{"ok 'it''s"s},
+                   });
+}
+
+BOOST_AUTO_TEST_CASE(nul_split_test)
+{
+    auto f = [](auto input, auto expected) {
+        auto result = std::vector<std::string>{};
+        parsing::nul_split(span<const char>{input.data(), input.size()},
+                           [&](auto token) { result.emplace_back(token); });
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(result.begin(),
+                                      result.end(),
+                                      expected.begin(),
+                                      expected.end());
+    };
+
+    test::data_set(
+        f,
+        {
+            std::tuple{""s, std::vector<std::string>{}},
+            std::tuple{"a"s, std::vector<std::string>{"a"}},
+            std::tuple{"a\0"s, std::vector<std::string>{"a"}},
+            std::tuple{"a b\0c\0"s, std::vector<std::string>{"a b", "c"}},
+            std::tuple{"a\0\0b"s, std::vector<std::string>{"a", "", "b"}},
+            std::tuple{"'a'\0\"b\""s, std::vector<std::string>{"'a'", "\"b\""}},
+        });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
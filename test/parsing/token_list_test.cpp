@@ -0,0 +1,147 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "arg_router/parsing/token_list.hpp"
+
+#include "test_helpers.hpp"
+#include "test_printers.hpp"
+
+using namespace arg_router;
+
+BOOST_AUTO_TEST_SUITE(parsing_suite)
+
+BOOST_AUTO_TEST_SUITE(token_list_suite)
+
+BOOST_AUTO_TEST_CASE(empty_test)
+{
+    const auto tokens = parsing::token_list{};
+    BOOST_CHECK(tokens.empty());
+    BOOST_CHECK_EQUAL(tokens.size(), 0);
+    BOOST_CHECK(tokens.begin() == tokens.end());
+}
+
+BOOST_AUTO_TEST_CASE(vector_constructor_test)
+{
+    const auto expected = std::vector<parsing::token_type>{{parsing::prefix_type::none, "--hello"},
+                                                           {parsing::prefix_type::none, "42"}};
+
+    const auto tokens = parsing::token_list{expected};
+    BOOST_CHECK_EQUAL(tokens.size(), 2);
+    BOOST_CHECK_EQUAL(tokens, expected);
+    BOOST_CHECK_EQUAL(tokens.front(), expected.front());
+    BOOST_CHECK_EQUAL(tokens[1], expected[1]);
+}
+
+BOOST_AUTO_TEST_CASE(erase_front_test)
+{
+    auto tokens = parsing::token_list{{parsing::prefix_type::none, "--hello"},
+                                      {parsing::prefix_type::none, "42"},
+                                      {parsing::prefix_type::none, "-f"},
+                                      {parsing::prefix_type::none, "goodbye"}};
+
+    // Erasing from the front does not move the remaining tokens, so the addresses are stable
+    const auto* third = &tokens[2];
+
+    auto it = tokens.erase(tokens.begin());
+    BOOST_CHECK(it == tokens.begin());
+    BOOST_CHECK_EQUAL(tokens.size(), 3);
+    BOOST_CHECK_EQUAL(tokens.front(), (parsing::token_type{parsing::prefix_type::none, "42"}));
+    BOOST_CHECK_EQUAL(&tokens[1], third);
+
+    tokens.erase(tokens.begin(), tokens.begin() + 2);
+    BOOST_CHECK_EQUAL(tokens.size(), 1);
+    BOOST_CHECK_EQUAL(tokens,
+                      (parsing::token_list{{parsing::prefix_type::none, "goodbye"}}));
+
+    tokens.erase(tokens.begin());
+    BOOST_CHECK(tokens.empty());
+}
+
+BOOST_AUTO_TEST_CASE(erase_middle_test)
+{
+    auto tokens = parsing::token_list{{parsing::prefix_type::none, "--hello"},
+                                      {parsing::prefix_type::none, "42"},
+                                      {parsing::prefix_type::none, "-f"},
+                                      {parsing::prefix_type::none, "goodbye"}};
+    tokens.erase(tokens.begin());
+
+    auto it = tokens.erase(tokens.begin() + 1);
+    BOOST_CHECK_EQUAL(*it, (parsing::token_type{parsing::prefix_type::none, "goodbye"}));
+    BOOST_CHECK_EQUAL(tokens,
+                      (parsing::token_list{{parsing::prefix_type::none, "42"},
+                                           {parsing::prefix_type::none, "goodbye"}}));
+}
+
+BOOST_AUTO_TEST_CASE(insert_front_test)
+{
+    auto tokens = parsing::token_list{{parsing::prefix_type::none, "--hello"},
+                                      {parsing::prefix_type::none, "42"},
+                                      {parsing::prefix_type::none, "-f"}};
+    tokens.erase(tokens.begin(), tokens.begin() + 2);
+    const auto* last = &tokens.front();
+
+    // There are two consumed slots at the front, so these re-use them
+    auto it = tokens.insert(tokens.begin(), {parsing::prefix_type::short_, "a"});
+    BOOST_CHECK(it == tokens.begin());
+    BOOST_CHECK_EQUAL(&tokens[1], last);
+
+    const auto extra = std::vector<parsing::token_type>{{parsing::prefix_type::short_, "b"}};
+    it = tokens.insert(tokens.begin(), extra.begin(), extra.end());
+    BOOST_CHECK(it == tokens.begin());
+    BOOST_CHECK_EQUAL(&tokens[2], last);
+    BOOST_CHECK_EQUAL(tokens,
+                      (parsing::token_list{{parsing::prefix_type::short_, "b"},
+                                           {parsing::prefix_type::short_, "a"},
+                                           {parsing::prefix_type::none, "-f"}}));
+
+    // No more space at the front, so fallback to a normal insertion
+    const auto more = std::vector<parsing::token_type>{{parsing::prefix_type::short_, "c"},
+                                                       {parsing::prefix_type::short_, "d"}};
+    it = tokens.insert(tokens.begin(), more.begin(), more.end());
+    BOOST_CHECK(it == tokens.begin());
+    BOOST_CHECK_EQUAL(tokens,
+                      (parsing::token_list{{parsing::prefix_type::short_, "c"},
+                                           {parsing::prefix_type::short_, "d"},
+                                           {parsing::prefix_type::short_, "b"},
+                                           {parsing::prefix_type::short_, "a"},
+                                           {parsing::prefix_type::none, "-f"}}));
+}
+
+BOOST_AUTO_TEST_CASE(append_test)
+{
+    auto tokens = parsing::token_list{};
+    tokens.reserve(2);
+    tokens.push_back({parsing::prefix_type::none, "--hello"});
+    tokens.emplace_back(parsing::prefix_type::none, "42");
+
+    BOOST_CHECK_EQUAL(tokens,
+                      (std::vector<parsing::token_type>{{parsing::prefix_type::none, "--hello"},
+                                                        {parsing::prefix_type::none, "42"}}));
+
+    tokens.erase(tokens.begin());
+    tokens.clear();
+    BOOST_CHECK(tokens.empty());
+}
+
+BOOST_AUTO_TEST_CASE(large_consumption_test)
+{
+    // Consuming one token at a time from a large list should not shift the remainder
+    constexpr auto count = std::size_t{100'000};
+
+    auto tokens = parsing::token_list{};
+    tokens.reserve(count);
+    for (auto i = 0u; i < count; ++i) {
+        tokens.emplace_back(parsing::prefix_type::none, "value");
+    }
+
+    const auto* last = &tokens[count - 1];
+    while (tokens.size() > 1) {
+        tokens.erase(tokens.begin());
+    }
+    BOOST_CHECK_EQUAL(&tokens.front(), last);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
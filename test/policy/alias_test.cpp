@@ -169,8 +169,11 @@ BOOST_AUTO_TEST_CASE(pre_parse_phase_test)
                   policy::router{[](bool, bool, bool) {}}},
     };
 
-    auto f = [&](auto args, auto expected_target_data, auto expected_args, auto parents_tuple) {
-        auto result = vector<parsing::token_type>{};
+    auto f = [&](parsing::token_list args,
+                 auto expected_target_data,
+                 auto expected_args,
+                 auto parents_tuple) {
+        auto result = parsing::token_buffer{};
 
         std::apply(
             [&](auto&& node, auto&&... parents) {
@@ -183,6 +186,7 @@ BOOST_AUTO_TEST_CASE(pre_parse_phase_test)
                                                               node.get(),
                                                               (parents.get())...);
                 BOOST_CHECK_EQUAL(match, parsing::pre_parse_action::skip_node_but_use_sub_targets);
+                adapter.commit();
 
                 BOOST_CHECK(target.tokens().empty());
                 BOOST_REQUIRE_EQUAL(expected_target_data.size(), target.sub_targets().size());
@@ -269,10 +273,10 @@ BOOST_AUTO_TEST_CASE(pre_parse_phase_too_small_view_test)
                   stub_node{policy::long_name<AR_STRING("arg3")>},
                   policy::router{[](bool, bool, bool) {}}};
 
-    auto result = std::vector<parsing::token_type>{{parsing::prefix_type::long_, "arg1"},
+    auto result = parsing::token_buffer{{parsing::prefix_type::long_, "arg1"},
                                                    {parsing::prefix_type::none, "42"}};
     const auto& owner = std::get<0>(root.children());
-    auto args = std::vector<parsing::token_type>{};
+    auto args = parsing::token_list{};
     auto adapter = parsing::dynamic_token_adapter{result, args};
     auto target = parsing::parse_target{owner, root};
 
@@ -355,13 +359,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         [[maybe_unused]] const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<0, typename stub_node::policies_type>;
             
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto target = parsing::parse_target{*this, parents...};
         (void)this->this_policy::pre_parse_phase(adapter,
@@ -377,7 +381,7 @@ int main() {
     const auto root = stub_node{policy::alias(policy::long_name<AR_STRING("flag2")>),
                                 policy::fixed_count<0>};
 
-    auto result = vector<parsing::token_type>{
+    auto result = parsing::token_buffer{
                         {parsing::prefix_type::long_, "flag2"},
                         {parsing::prefix_type::long_, "flag3"}};
     root.pre_parse_phase(result);
@@ -409,13 +413,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         [[maybe_unused]] const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<1, typename stub_node::policies_type>;
             
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto target = parsing::parse_target{*this, parents...};
         (void)this->this_policy::pre_parse_phase(adapter,
@@ -434,7 +438,7 @@ int main() {
                         policy::alias(policy::long_name<AR_STRING("flag2")>)},
               stub_node{policy::long_name<AR_STRING("flag2")>}};;
 
-    auto result = vector<parsing::token_type>{
+    auto result = parsing::token_buffer{
                     {parsing::prefix_type::long_, "flag2"}};
     const auto& owner = std::get<0>(root.children());
 
@@ -468,13 +472,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         [[maybe_unused]] const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<2, typename stub_node::policies_type>;
             
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto target = parsing::parse_target{*this, parents...};
         (void)this->this_policy::pre_parse_phase(adapter,
@@ -494,7 +498,7 @@ int main() {
                         policy::alias(policy::long_name<AR_STRING("flag2")>)},
               stub_node{policy::long_name<AR_STRING("flag2")>}};;
 
-    auto result = vector<parsing::token_type>{
+    auto result = parsing::token_buffer{
                     {parsing::prefix_type::long_, "flag2"}};
     const auto& owner = std::get<0>(root.children());
 
@@ -527,13 +531,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         [[maybe_unused]] const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<1, typename stub_node::policies_type>;
             
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto target = parsing::parse_target{*this, parents...};
         (void)this->this_policy::pre_parse_phase(adapter,
@@ -553,7 +557,7 @@ int main() {
               stub_node{policy::long_name<AR_STRING("flag2")>},
               stub_node{policy::long_name<AR_STRING("flag3")>}};
 
-    auto result = vector<parsing::token_type>{
+    auto result = parsing::token_buffer{
                     {parsing::prefix_type::long_, "flag2"},
                     {parsing::prefix_type::long_, "flag3"}};
     const auto& owner = std::get<0>(root.children());
@@ -589,13 +593,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         [[maybe_unused]] const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<1, typename stub_node::policies_type>;
             
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto target = parsing::parse_target{*this, parents...};
         (void)this->this_policy::pre_parse_phase(adapter,
@@ -621,7 +625,7 @@ int main() {
                             policy::fixed_count<1>},
                   policy::router{[](bool, bool, bool) {}}};
 
-    auto result = vector<parsing::token_type>{
+    auto result = parsing::token_buffer{
                     {parsing::prefix_type::long_, "flag2"},
                     {parsing::prefix_type::long_, "flag3"}};
     const auto& owner = std::get<0>(root.children());
@@ -657,13 +661,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         [[maybe_unused]] const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<1, typename stub_node::policies_type>;
             
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto target = parsing::parse_target{*this, parents...};
         (void)this->this_policy::pre_parse_phase(adapter,
@@ -685,7 +689,7 @@ int main() {
                   stub_node{policy::long_name<AR_STRING("flag3")>},
                   policy::router{[](bool, bool, bool) {}}};
 
-    auto result = vector<parsing::token_type>{
+    auto result = parsing::token_buffer{
                     {parsing::prefix_type::long_, "flag2"},
                     {parsing::prefix_type::long_, "flag3"}};
     const auto& owner = std::get<0>(root.children());
@@ -721,13 +725,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         [[maybe_unused]] const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<1, typename stub_node::policies_type>;
             
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto target = parsing::parse_target{*this, parents...};
         (void)this->this_policy::pre_parse_phase(adapter,
@@ -750,7 +754,7 @@ int main() {
                   stub_node{policy::long_name<AR_STRING("flag3")>},
                   policy::router{[](bool, bool, bool) {}}};
 
-    auto result = vector<parsing::token_type>{
+    auto result = parsing::token_buffer{
                     {parsing::prefix_type::long_, "flag2"},
                     {parsing::prefix_type::long_, "flag3"}};
     const auto& owner = std::get<0>(root.children());
@@ -787,13 +791,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         [[maybe_unused]] const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<1, typename stub_node::policies_type>;
             
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto target = parsing::parse_target{*this, parents...};
         (void)this->this_policy::pre_parse_phase(adapter,
@@ -817,7 +821,7 @@ int main() {
                   stub_node{policy::long_name<AR_STRING("flag3")>},
                   policy::router{[](bool, bool, bool) {}}};
 
-    auto result = vector<parsing::token_type>{
+    auto result = parsing::token_buffer{
                     {parsing::prefix_type::long_, "flag2"},
                     {parsing::prefix_type::long_, "flag3"}};
     const auto& owner = std::get<0>(root.children());
@@ -853,13 +857,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         [[maybe_unused]] const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<1, typename stub_node::policies_type>;
             
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto target = parsing::parse_target{*this, parents...};
         (void)this->this_policy::pre_parse_phase(adapter,
@@ -877,7 +881,7 @@ int main() {
                                 policy::custom_parser<bool>{
                                     [](std::string_view) { return false; }}};
 
-    auto result = vector<parsing::token_type>{
+    auto result = parsing::token_buffer{
                     {parsing::prefix_type::long_, "flag2"},
                     {parsing::prefix_type::long_, "flag3"}};
 
@@ -912,13 +916,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         [[maybe_unused]] const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<1, typename stub_node::policies_type>;
             
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto target = parsing::parse_target{*this, parents...};
         (void)this->this_policy::pre_parse_phase(adapter,
@@ -935,7 +939,7 @@ int main() {
                                 policy::alias(policy::long_name<AR_STRING("flag2")>),
                                 policy::min_max_value<3, 6>()};
 
-    auto result = vector<parsing::token_type>{
+    auto result = parsing::token_buffer{
                     {parsing::prefix_type::long_, "flag2"},
                     {parsing::prefix_type::long_, "flag3"}};
 
@@ -970,13 +974,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         [[maybe_unused]] const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<1, typename stub_node::policies_type>;
 
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto target = parsing::parse_target{*this, parents...};
         (void)this->this_policy::pre_parse_phase(adapter,
@@ -993,7 +997,7 @@ int main() {
                                 policy::alias(policy::long_name<AR_STRING("flag2")>),
                                 policy::router{[](bool) {}}};
 
-    auto result = vector<parsing::token_type>{
+    auto result = parsing::token_buffer{
                     {parsing::prefix_type::long_, "flag2"},
                     {parsing::prefix_type::long_, "flag3"}};
 
@@ -1029,13 +1033,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         [[maybe_unused]] const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<1, typename stub_node::policies_type>;
 
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto target = parsing::parse_target{*this, parents...};
         (void)this->this_policy::pre_parse_phase(adapter,
@@ -1061,7 +1065,7 @@ int main() {
                             policy::fixed_count<2>},
                   policy::router{[](bool, bool) {}}};
 
-    auto result = vector<parsing::token_type>{
+    auto result = parsing::token_buffer{
                     {parsing::prefix_type::long_, "flag2"}};
 
     const auto& owner = std::get<0>(root.children());
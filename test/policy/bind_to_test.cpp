@@ -0,0 +1,160 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "arg_router/policy/bind_to.hpp"
+#include "arg_router/arg.hpp"
+#include "arg_router/flag.hpp"
+#include "arg_router/help.hpp"
+#include "arg_router/mode.hpp"
+#include "arg_router/policy/default_value.hpp"
+#include "arg_router/policy/display_name.hpp"
+#include "arg_router/policy/long_name.hpp"
+#include "arg_router/policy/router.hpp"
+#include "arg_router/policy/validator.hpp"
+#include "arg_router/positional_arg.hpp"
+#include "arg_router/root.hpp"
+#include "arg_router/utility/compile_time_string.hpp"
+
+#include "test_helpers.hpp"
+#include "test_printers.hpp"
+
+using namespace arg_router;
+
+namespace
+{
+struct bound_args {
+    bool flag1;
+    int arg1;
+    std::vector<std::string_view> paths;
+};
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(policy_suite)
+
+BOOST_AUTO_TEST_SUITE(bind_to_suite)
+
+BOOST_AUTO_TEST_CASE(is_policy_test)
+{
+    static_assert(policy::is_policy_v<policy::bind_to_t<bound_args>>, "Policy test has failed");
+}
+
+BOOST_AUTO_TEST_CASE(bind_test)
+{
+    constexpr auto result = policy::bind_to_t<std::pair<int, bool>>::bind(42, true);
+    static_assert(result.first == 42, "Bind test has failed");
+    static_assert(result.second, "Bind test has failed");
+}
+
+BOOST_AUTO_TEST_CASE(parse_test)
+{
+    auto result = std::optional<bound_args>{};
+    const auto r = root(
+        help(policy::long_name<AR_STRING("help")>),
+        mode(flag(policy::long_name<AR_STRING("flag1")>),
+             arg<int>(policy::long_name<AR_STRING("arg1")>, policy::default_value{3}),
+             positional_arg<std::vector<std::string_view>>(
+                 policy::display_name<AR_STRING("PATHS")>),
+             policy::bind_to<bound_args>,
+             policy::router{[&](bound_args args) { result = std::move(args); }}),
+        policy::validation::default_validator);
+
+    auto f = [&](auto tokens, auto expected_flag1, auto expected_arg1, auto expected_paths) {
+        result.reset();
+
+        auto args = vector<parsing::token_type>{};
+        for (auto token : tokens) {
+            args.emplace_back(parsing::prefix_type::none, token);
+        }
+        r.parse(std::move(args));
+
+        BOOST_REQUIRE(result);
+        BOOST_CHECK_EQUAL(result->flag1, expected_flag1);
+        BOOST_CHECK_EQUAL(result->arg1, expected_arg1);
+        BOOST_CHECK_EQUAL(result->paths, expected_paths);
+    };
+
+    test::data_set(
+        f,
+        {
+            std::tuple{std::vector<std::string_view>{}, false, 3, std::vector<std::string_view>{}},
+            std::tuple{std::vector<std::string_view>{"--flag1", "--arg1", "42"},
+                       true,
+                       42,
+                       std::vector<std::string_view>{}},
+            std::tuple{std::vector<std::string_view>{"--arg1", "42", "a", "b"},
+                       false,
+                       42,
+                       std::vector<std::string_view>{"a", "b"}},
+        });
+}
+
+BOOST_AUTO_TEST_SUITE(death_suite)
+
+BOOST_AUTO_TEST_CASE(must_be_in_mode_test)
+{
+    test::death_test_compile(
+        R"(
+#include "arg_router/arg.hpp"
+#include "arg_router/mode.hpp"
+#include "arg_router/policy/bind_to.hpp"
+#include "arg_router/policy/long_name.hpp"
+#include "arg_router/policy/router.hpp"
+#include "arg_router/policy/validator.hpp"
+#include "arg_router/root.hpp"
+
+using namespace arg_router;
+
+namespace
+{
+struct bound_args {
+    int arg1;
+};
+}  // namespace
+
+int main() {
+    const auto r = root(mode(arg<int>(policy::long_name<AR_STRING("arg1")>,
+                                      policy::bind_to<bound_args>),
+                             policy::router{[](int) {}}),
+                        policy::validation::default_validator);
+    return 0;
+}
+    )",
+        "Parent must be one of a set of types");
+}
+
+BOOST_AUTO_TEST_CASE(must_have_router_test)
+{
+    test::death_test_compile(
+        R"(
+#include "arg_router/arg.hpp"
+#include "arg_router/mode.hpp"
+#include "arg_router/policy/bind_to.hpp"
+#include "arg_router/policy/long_name.hpp"
+#include "arg_router/policy/none_name.hpp"
+#include "arg_router/utility/compile_time_string.hpp"
+
+using namespace arg_router;
+
+namespace
+{
+struct bound_args {
+    int arg1;
+};
+}  // namespace
+
+int main() {
+    const auto m = mode(policy::none_name<AR_STRING("mode")>,
+                        arg<int>(policy::long_name<AR_STRING("arg1")>),
+                        policy::bind_to<bound_args>);
+    return 0;
+}
+    )",
+        "Mode with bind_to must have a router");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
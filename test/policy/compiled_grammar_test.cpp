@@ -0,0 +1,268 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "arg_router/policy/compiled_grammar.hpp"
+#include "arg_router/arg.hpp"
+#include "arg_router/dependency/one_of.hpp"
+#include "arg_router/flag.hpp"
+#include "arg_router/mode.hpp"
+#include "arg_router/policy/default_value.hpp"
+#include "arg_router/policy/display_name.hpp"
+#include "arg_router/policy/long_name.hpp"
+#include "arg_router/policy/none_name.hpp"
+#include "arg_router/policy/router.hpp"
+#include "arg_router/policy/runtime_enable.hpp"
+#include "arg_router/policy/short_name.hpp"
+#include "arg_router/policy/validator.hpp"
+#include "arg_router/policy/value_separator.hpp"
+#include "arg_router/positional_arg.hpp"
+#include "arg_router/root.hpp"
+
+#include "test_helpers.hpp"
+#include "test_printers.hpp"
+
+using namespace arg_router;
+using namespace std::string_literals;
+
+namespace ard = arg_router::dependency;
+
+namespace
+{
+template <typename... Policies>
+auto make_root(std::string& outcome, bool enable_m3, Policies... policies)
+{
+    return root(
+        policies...,
+        mode(policy::none_name<AR_STRING("m1")>,
+             flag(policy::long_name<AR_STRING("flag1")>, policy::short_name<'a'>),
+             arg<int>(policy::long_name<AR_STRING("arg1")>, policy::default_value{0}),
+             mode(policy::none_name<AR_STRING("m2")>,
+                  flag(policy::long_name<AR_STRING("flag2")>),
+                  positional_arg<std::vector<std::string_view>>(
+                      policy::display_name<AR_STRING("pos")>),
+                  policy::router{[&](bool flag2, auto pos) {
+                      outcome = "m2 "s + std::to_string(flag2) + " " + std::to_string(pos.size());
+                  }}),
+             mode(policy::none_name<AR_STRING("m3")>,
+                  policy::runtime_enable{enable_m3},
+                  flag(policy::long_name<AR_STRING("flag3")>),
+                  policy::router{
+                      [&](bool flag3) { outcome = "m3 "s + std::to_string(flag3); }}),
+             policy::router{[&](bool flag1, int arg1) {
+                 outcome = "m1 "s + std::to_string(flag1) + " " + std::to_string(arg1);
+             }}),
+        mode(flag(policy::long_name<AR_STRING("top")>),
+             policy::router{[&](bool top) { outcome = "top "s + std::to_string(top); }}),
+        policy::validation::default_validator);
+}
+
+using root_type = decltype(make_root(std::declval<std::string&>(), true, policy::compiled_grammar));
+
+// The unnamed children are tried for every token, so the named options after them cannot be
+// jumped to directly
+struct separator_tree {
+    template <typename... Policies>
+    auto operator()(std::string& outcome, Policies... policies) const
+    {
+        return root(policies...,
+                    mode(arg<int>(policy::long_name<AR_STRING("num")>,
+                                  policy::value_separator<'='>,
+                                  policy::default_value{0}),
+                         flag(policy::long_name<AR_STRING("foo")>),
+                         policy::router{[&](int num, bool foo) {
+                             outcome = std::to_string(num) + " " + std::to_string(foo);
+                         }}),
+                    policy::validation::default_validator);
+    }
+};
+
+struct one_of_tree {
+    template <typename... Policies>
+    auto operator()(std::string& outcome, Policies... policies) const
+    {
+        return root(policies...,
+                    mode(ard::one_of(arg<int>(policy::long_name<AR_STRING("aa")>),
+                                     arg<double>(policy::long_name<AR_STRING("bb")>),
+                                     policy::default_value{0}),
+                         flag(policy::long_name<AR_STRING("cc")>),
+                         policy::router{[&](std::variant<int, double> of, bool cc) {
+                             outcome = std::to_string(of.index()) + " " + std::to_string(cc);
+                         }}),
+                    policy::validation::default_validator);
+    }
+};
+
+// The results, including the errors, must match the tree without a compiled grammar
+template <typename Tree>
+void check_parse(std::vector<const char*> args, const std::string& expected)
+{
+    args.insert(args.begin(), "foo");
+
+    auto plain_outcome = std::string{};
+    auto compiled_outcome = std::string{};
+    const auto plain_root = Tree{}(plain_outcome);
+    const auto compiled_root = Tree{}(compiled_outcome, policy::compiled_grammar);
+
+    const auto argc = static_cast<int>(args.size());
+    auto** argv = const_cast<char**>(args.data());
+    if (const auto result = plain_root.try_parse(argc, argv); !result) {
+        plain_outcome = result.get_error_if()->what();
+    }
+    if (const auto result = compiled_root.try_parse(argc, argv); !result) {
+        compiled_outcome = result.get_error_if()->what();
+    }
+
+    BOOST_CHECK_EQUAL(plain_outcome, expected);
+    BOOST_CHECK_EQUAL(compiled_outcome, expected);
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(policy_suite)
+
+BOOST_AUTO_TEST_SUITE(compiled_grammar_suite)
+
+BOOST_AUTO_TEST_CASE(is_policy_test)
+{
+    static_assert(policy::is_policy_v<policy::compiled_grammar_t<>>, "Policy test has failed");
+}
+
+BOOST_AUTO_TEST_CASE(has_compiled_grammar_test)
+{
+    static_assert(policy::has_compiled_grammar_v<root_type>, "Policy detection has failed");
+    static_assert(!policy::has_compiled_grammar_v<decltype(make_root(
+                      std::declval<std::string&>(),
+                      true))>,
+                  "Policy detection has failed");
+    static_assert(!policy::has_compiled_grammar_v<int>, "Policy detection has failed");
+}
+
+BOOST_AUTO_TEST_CASE(transitions_test)
+{
+    using m1_type = std::tuple_element_t<0, root_type::children_type>;
+
+    {
+        // The anonymous mode is not named so it has no entry
+        constexpr auto& entries = policy::detail::grammar_transitions<root_type>::entries;
+        static_assert(entries.size() == 1);
+        static_assert(entries[0].name == "m1");
+        static_assert(entries[0].index == 0);
+        static_assert(entries[0].enterable);
+    }
+
+    {
+        // Only child modes are candidates in a mode, and runtime_enable has to run when m3's
+        // label is matched so it cannot be entered directly
+        constexpr auto& entries = policy::detail::grammar_transitions<m1_type>::entries;
+        static_assert(entries.size() == 2);
+        static_assert(entries[0].name == "m2");
+        static_assert(entries[0].index == 2);
+        static_assert(entries[0].enterable);
+        static_assert(entries[1].name == "m3");
+        static_assert(entries[1].index == 3);
+        static_assert(!entries[1].enterable);
+    }
+
+    using transitions_type = policy::detail::grammar_transitions<m1_type>;
+    BOOST_CHECK_EQUAL(transitions_type::find({parsing::prefix_type::none, "m2"}), 2u);
+    BOOST_CHECK_EQUAL(transitions_type::find({parsing::prefix_type::none, "m3"}), 4u);
+    BOOST_CHECK_EQUAL(transitions_type::find({parsing::prefix_type::long_, "m2"}), 4u);
+    BOOST_CHECK_EQUAL(transitions_type::find({parsing::prefix_type::none, "m1"}), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(parse_test)
+{
+    auto f = [&](auto args, bool enable_m3, std::string expected) {
+        args.insert(args.begin(), "foo");
+
+        // The results, including the errors, must match the tree without a compiled grammar
+        auto plain_outcome = std::string{};
+        auto compiled_outcome = std::string{};
+        const auto plain_root = make_root(plain_outcome, enable_m3);
+        const auto compiled_root = make_root(compiled_outcome, enable_m3, policy::compiled_grammar);
+
+        const auto argc = static_cast<int>(args.size());
+        auto** argv = const_cast<char**>(args.data());
+        if (const auto result = plain_root.try_parse(argc, argv); !result) {
+            plain_outcome = result.get_error_if()->what();
+        }
+        if (const auto result = compiled_root.try_parse(argc, argv); !result) {
+            compiled_outcome = result.get_error_if()->what();
+        }
+
+        BOOST_CHECK_EQUAL(plain_outcome, expected);
+        BOOST_CHECK_EQUAL(compiled_outcome, expected);
+    };
+
+    test::data_set(
+        f,
+        {
+            std::tuple{std::vector{"m1"}, true, "m1 0 0"s},
+            std::tuple{std::vector{"m1", "--arg1", "42", "-a"}, true, "m1 1 42"s},
+            std::tuple{std::vector{"m1", "m2", "--flag2", "x", "y"}, true, "m2 1 2"s},
+            std::tuple{std::vector{"m1", "m2", "m2"}, true, "m2 0 1"s},
+            std::tuple{std::vector{"m1", "m3", "--flag3"}, true, "m3 1"s},
+            std::tuple{std::vector{"m1", "m3", "--flag3"},
+                       false,
+                       "Unknown argument: m3. Did you mean m2?"s},
+            std::tuple{std::vector{"--top"}, true, "top 1"s},
+            std::tuple{std::vector{"m1", "--foo"},
+                       true,
+                       "Unknown argument: --foo. Did you mean -a?"s},
+            std::tuple{std::vector{"m1", "-a", "--flag1"},
+                       true,
+                       "Argument has already been set: --flag1"s},
+            std::tuple{std::vector{"m1", "--arg1"},
+                       true,
+                       "Minimum count not reached: --arg1"s},
+            std::tuple{std::vector{"m1", "m2", "--flag2", "--flag2"},
+                       true,
+                       "Argument has already been set: --flag2"s},
+            std::tuple{std::vector{"m2"}, true, "Unknown argument: m2. Did you mean --top?"s},
+        });
+}
+
+BOOST_AUTO_TEST_CASE(unnamed_children_parse_test)
+{
+    check_parse<separator_tree>({"--foo"}, "0 1");
+    check_parse<separator_tree>({"--num=4", "--foo"}, "4 1");
+    check_parse<separator_tree>({"--foo", "--num=4"}, "4 1");
+    check_parse<separator_tree>({"--fop"}, "Unknown argument: --fop. Did you mean --foo?");
+
+    check_parse<one_of_tree>({"--cc"}, "0 1");
+    check_parse<one_of_tree>({"--bb", "3", "--cc"}, "1 1");
+    check_parse<one_of_tree>({"--cc", "--aa", "3"}, "0 1");
+}
+
+BOOST_AUTO_TEST_SUITE(death_suite)
+
+BOOST_AUTO_TEST_CASE(must_be_on_root_test)
+{
+    test::death_test_compile(
+        R"(
+#include "arg_router/flag.hpp"
+#include "arg_router/mode.hpp"
+#include "arg_router/policy/compiled_grammar.hpp"
+#include "arg_router/policy/long_name.hpp"
+#include "arg_router/policy/router.hpp"
+#include "arg_router/policy/validator.hpp"
+#include "arg_router/root.hpp"
+
+using namespace arg_router;
+
+int main() {
+    const auto r = root(mode(policy::compiled_grammar,
+                             flag(policy::long_name<AR_STRING("flag1")>),
+                             policy::router{[](bool) {}}),
+                        policy::validation::default_validator);
+    return 0;
+}
+    )",
+        "T must have none of these policies");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,161 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "arg_router/policy/config_file.hpp"
+#include "arg_router/arg.hpp"
+#include "arg_router/flag.hpp"
+#include "arg_router/mode.hpp"
+#include "arg_router/policy/validator.hpp"
+#include "arg_router/positional_arg.hpp"
+#include "arg_router/root.hpp"
+
+#include "test_helpers.hpp"
+#include "test_printers.hpp"
+
+#include <filesystem>
+
+using namespace arg_router;
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+BOOST_AUTO_TEST_SUITE(policy_suite)
+
+BOOST_AUTO_TEST_SUITE(config_file_suite)
+
+BOOST_AUTO_TEST_CASE(is_policy_test)
+{
+    static_assert(policy::is_policy_v<policy::config_file<>>, "Policy test has failed");
+}
+
+BOOST_AUTO_TEST_CASE(anonymous_mode_parse_test)
+{
+    const auto config = test::temp_file{
+        "# Defaults\n"
+        "verbose = true\n"
+        "j = 4\n"
+        "FILE = 'a b.txt'\n"
+        "[other]\n"
+        "verbose = false\n"sv};
+
+    auto result = std::tuple<bool, int, std::string>{};
+    const auto r = root(policy::config_file{config.path()},
+                        mode(flag(policy::long_name<AR_STRING("verbose")>),
+                             arg<int>(policy::short_name<'j'>, policy::default_value{1}),
+                             positional_arg<std::string>(policy::display_name<AR_STRING("FILE")>,
+                                                         policy::fixed_count<1>),
+                             policy::router{[&](bool verbose, int jobs, std::string file) {
+                                 result = {verbose, jobs, std::move(file)};
+                             }}),
+                        policy::validation::default_validator);
+
+    auto args = std::vector{"foo"};
+    r.parse(static_cast<int>(args.size()), const_cast<char**>(args.data()));
+    BOOST_CHECK_EQUAL(std::get<0>(result), true);
+    BOOST_CHECK_EQUAL(std::get<1>(result), 4);
+    BOOST_CHECK_EQUAL(std::get<2>(result), "a b.txt");
+
+    args = std::vector{"foo", "-j", "2", "c.txt"};
+    r.parse(static_cast<int>(args.size()), const_cast<char**>(args.data()));
+    BOOST_CHECK_EQUAL(std::get<0>(result), true);
+    BOOST_CHECK_EQUAL(std::get<1>(result), 2);
+    BOOST_CHECK_EQUAL(std::get<2>(result), "c.txt");
+}
+
+BOOST_AUTO_TEST_CASE(named_mode_parse_test)
+{
+    const auto config = test::temp_file{
+        "force = true\n"
+        "[copy]\n"
+        "dest = \"/tmp/copy dest\"\n"
+        "[move]\n"
+        "force = yes\n"sv};
+
+    auto result = std::tuple<std::string, bool, std::string>{};
+    const auto r = root(
+        policy::config_file{config.path()},
+        mode(policy::none_name<AR_STRING("copy")>,
+             flag(policy::long_name<AR_STRING("force")>),
+             arg<std::string>(policy::long_name<AR_STRING("dest")>, policy::required),
+             policy::router{[&](bool force, std::string dest) {
+                 result = {"copy", force, std::move(dest)};
+             }}),
+        mode(policy::none_name<AR_STRING("move")>,
+             flag(policy::long_name<AR_STRING("force")>),
+             arg<std::string>(policy::long_name<AR_STRING("dest")>,
+                              policy::default_value{"here"s}),
+             policy::router{[&](bool force, std::string dest) {
+                 result = {"move", force, std::move(dest)};
+             }}),
+        policy::validation::default_validator);
+
+    auto args = std::vector{"foo", "copy"};
+    r.parse(static_cast<int>(args.size()), const_cast<char**>(args.data()));
+    BOOST_CHECK_EQUAL(std::get<0>(result), "copy");
+    BOOST_CHECK_EQUAL(std::get<1>(result), false);
+    BOOST_CHECK_EQUAL(std::get<2>(result), "/tmp/copy dest");
+
+    args = std::vector{"foo", "move"};
+    r.parse(static_cast<int>(args.size()), const_cast<char**>(args.data()));
+    BOOST_CHECK_EQUAL(std::get<0>(result), "move");
+    BOOST_CHECK_EQUAL(std::get<1>(result), true);
+    BOOST_CHECK_EQUAL(std::get<2>(result), "here");
+}
+
+BOOST_AUTO_TEST_CASE(indexed_once_test)
+{
+    auto result = 0;
+    auto config = std::make_unique<test::temp_file>("threads = 3\n"sv);
+    const auto r = root(policy::config_file{config->path()},
+                        mode(arg<int>(policy::long_name<AR_STRING("threads")>,
+                                      policy::default_value{1}),
+                             policy::router{[&](int threads) { result = threads; }}),
+                        policy::validation::default_validator);
+
+    auto args = std::vector{"foo"};
+    r.parse(static_cast<int>(args.size()), const_cast<char**>(args.data()));
+    BOOST_CHECK_EQUAL(result, 3);
+
+    // Removing the file has no effect as it is not re-read, and copies share the same index
+    config.reset();
+    const auto r2 = r;
+    result = 0;
+    r2.parse(static_cast<int>(args.size()), const_cast<char**>(args.data()));
+    BOOST_CHECK_EQUAL(result, 3);
+}
+
+BOOST_AUTO_TEST_CASE(missing_file_test)
+{
+    auto result = 0;
+    const auto r = root(policy::config_file{"/this/file/does/not/exist"},
+                        mode(arg<int>(policy::long_name<AR_STRING("threads")>,
+                                      policy::default_value{1}),
+                             policy::router{[&](int threads) { result = threads; }}),
+                        policy::validation::default_validator);
+
+    auto args = std::vector{"foo"};
+    r.parse(static_cast<int>(args.size()), const_cast<char**>(args.data()));
+    BOOST_CHECK_EQUAL(result, 1);
+}
+
+BOOST_AUTO_TEST_CASE(invalid_file_test)
+{
+    const auto config = test::temp_file{"threads = 3\nhello\n"sv};
+    const auto r = root(policy::config_file{config.path()},
+                        mode(arg<int>(policy::long_name<AR_STRING("threads")>,
+                                      policy::default_value{1}),
+                             policy::router{[&](int) {}}),
+                        policy::validation::default_validator);
+
+    auto args = std::vector{"foo"};
+    try {
+        r.parse(static_cast<int>(args.size()), const_cast<char**>(args.data()));
+        BOOST_CHECK_MESSAGE(false, "Exception expected");
+    } catch (parse_exception& e) {
+        BOOST_CHECK_EQUAL(e.what(), "Invalid config file line: hello"s);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,229 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "arg_router/policy/env_fallback.hpp"
+#include "arg_router/arg.hpp"
+#include "arg_router/counting_flag.hpp"
+#include "arg_router/flag.hpp"
+#include "arg_router/mode.hpp"
+#include "arg_router/policy/config_file.hpp"
+#include "arg_router/policy/min_max_value.hpp"
+#include "arg_router/policy/required.hpp"
+#include "arg_router/policy/runtime_enable.hpp"
+#include "arg_router/policy/validator.hpp"
+#include "arg_router/root.hpp"
+
+#include "test_helpers.hpp"
+#include "test_printers.hpp"
+
+#include <cstdlib>
+
+using namespace arg_router;
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+namespace
+{
+// Sets an environment variable for the lifetime of the instance
+class scoped_env
+{
+public:
+    scoped_env(const char* name, const char* value) : name_{name}
+    {
+#ifdef _WIN32
+        ::_putenv_s(name_, value);
+#else
+        ::setenv(name_, value, 1);
+#endif
+    }
+
+    scoped_env(const scoped_env&) = delete;
+    scoped_env& operator=(const scoped_env&) = delete;
+
+    ~scoped_env()
+    {
+#ifdef _WIN32
+        ::_putenv_s(name_, "");
+#else
+        ::unsetenv(name_);
+#endif
+    }
+
+private:
+    const char* name_;
+};
+
+using env_type = std::vector<std::pair<const char*, const char*>>;
+using result_type = std::tuple<bool, std::size_t, int, std::string>;
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(policy_suite)
+
+BOOST_AUTO_TEST_SUITE(env_fallback_suite)
+
+BOOST_AUTO_TEST_CASE(is_policy_test)
+{
+    static_assert(policy::is_policy_v<policy::env_fallback_t<AR_STRING("AR_TEST")>>,
+                  "Policy test has failed");
+}
+
+BOOST_AUTO_TEST_CASE(env_value_test)
+{
+    using policy_type = std::decay_t<decltype(policy::env_fallback<AR_STRING("AR_TEST_VALUE")>)>;
+    static_assert(policy_type::env_variable() == "AR_TEST_VALUE", "Variable name test has failed");
+
+    BOOST_CHECK(!policy_type::env_value());
+    {
+        const auto env = scoped_env{"AR_TEST_VALUE", "hello"};
+        BOOST_CHECK(policy_type::env_value() == "hello");
+    }
+    BOOST_CHECK(!policy_type::env_value());
+}
+
+BOOST_AUTO_TEST_CASE(parse_test)
+{
+    auto router_hit = false;
+    auto result = result_type{};
+    const auto r = root(mode(flag(policy::long_name<AR_STRING("verbose")>,
+                                  policy::env_fallback<AR_STRING("AR_TEST_VERBOSE")>),
+                             counting_flag<std::size_t>(
+                                 policy::short_name<'c'>,
+                                 policy::env_fallback<AR_STRING("AR_TEST_COUNT")>),
+                             arg<int>(policy::long_name<AR_STRING("threads")>,
+                                      policy::env_fallback<AR_STRING("AR_TEST_THREADS")>,
+                                      policy::default_value{1},
+                                      policy::min_max_value<1, 8>()),
+                             arg<std::string>(policy::long_name<AR_STRING("name")>,
+                                              policy::env_fallback<AR_STRING("AR_TEST_NAME")>,
+                                              policy::required),
+                             policy::router{[&](bool verbose,
+                                                std::size_t count,
+                                                int threads,
+                                                std::string name) {
+                                 result = {verbose, count, threads, std::move(name)};
+                                 router_hit = true;
+                             }}),
+                        policy::validation::default_validator);
+
+    auto f = [&](auto env, auto args, auto expected, std::string fail_message) {
+        auto env_guards = std::vector<std::unique_ptr<scoped_env>>{};
+        for (auto [name, value] : env) {
+            env_guards.push_back(std::make_unique<scoped_env>(name, value));
+        }
+
+        result = {};
+        router_hit = false;
+        try {
+            r.parse(static_cast<int>(args.size()), const_cast<char**>(args.data()));
+            BOOST_CHECK(fail_message.empty());
+            BOOST_CHECK(router_hit);
+            BOOST_CHECK_EQUAL(std::get<0>(result), std::get<0>(expected));
+            BOOST_CHECK_EQUAL(std::get<1>(result), std::get<1>(expected));
+            BOOST_CHECK_EQUAL(std::get<2>(result), std::get<2>(expected));
+            BOOST_CHECK_EQUAL(std::get<3>(result), std::get<3>(expected));
+        } catch (parse_exception& e) {
+            BOOST_CHECK_EQUAL(fail_message, e.what());
+            BOOST_CHECK(!router_hit);
+        }
+    };
+
+    test::data_set(
+        f,
+        {
+            std::tuple{env_type{},
+                       std::vector{"foo", "--name", "bob"},
+                       result_type{false, 0, 1, "bob"},
+                       ""},
+            std::tuple{env_type{},
+                       std::vector{"foo"},
+                       result_type{},
+                       "Missing required argument: --name"},
+            std::tuple{env_type{{"AR_TEST_NAME", "alice"}},
+                       std::vector{"foo"},
+                       result_type{false, 0, 1, "alice"},
+                       ""},
+            std::tuple{env_type{{"AR_TEST_NAME", "alice"}},
+                       std::vector{"foo", "--name", "bob"},
+                       result_type{false, 0, 1, "bob"},
+                       ""},
+            std::tuple{env_type{{"AR_TEST_NAME", "alice"},
+                                {"AR_TEST_VERBOSE", "yes"},
+                                {"AR_TEST_COUNT", "3"},
+                                {"AR_TEST_THREADS", "4"}},
+                       std::vector{"foo"},
+                       result_type{true, 3, 4, "alice"},
+                       ""},
+            std::tuple{env_type{{"AR_TEST_NAME", "alice"},
+                                {"AR_TEST_VERBOSE", "off"},
+                                {"AR_TEST_THREADS", "4"}},
+                       std::vector{"foo", "--threads", "2", "-cc"},
+                       result_type{false, 2, 2, "alice"},
+                       ""},
+            std::tuple{env_type{{"AR_TEST_NAME", "alice"}, {"AR_TEST_VERBOSE", "maybe"}},
+                       std::vector{"foo"},
+                       result_type{},
+                       "Failed to parse: maybe"},
+            std::tuple{env_type{{"AR_TEST_NAME", "alice"}, {"AR_TEST_THREADS", "four"}},
+                       std::vector{"foo"},
+                       result_type{},
+                       "Failed to parse: four"},
+            std::tuple{env_type{{"AR_TEST_NAME", "alice"}, {"AR_TEST_THREADS", "9"}},
+                       std::vector{"foo"},
+                       result_type{},
+                       "Maximum value exceeded: --threads"},
+        });
+}
+
+BOOST_AUTO_TEST_CASE(runtime_disabled_test)
+{
+    auto result = std::optional<int>{};
+    const auto r = root(mode(arg<int>(policy::long_name<AR_STRING("threads")>,
+                                      policy::env_fallback<AR_STRING("AR_TEST_THREADS")>,
+                                      policy::runtime_enable{false},
+                                      policy::default_value{1}),
+                             policy::router{[&](int threads) { result = threads; }}),
+                        policy::validation::default_validator);
+
+    const auto env = scoped_env{"AR_TEST_THREADS", "4"};
+    auto args = std::vector{"foo"};
+    r.parse(static_cast<int>(args.size()), const_cast<char**>(args.data()));
+    BOOST_CHECK_EQUAL(result, 1);
+}
+
+BOOST_AUTO_TEST_CASE(config_file_precedence_test)
+{
+    const auto config = test::temp_file{"threads = 3\nname = carol\n"sv};
+
+    auto result = std::tuple<int, std::string>{};
+    const auto r = root(policy::config_file{config.path()},
+                        mode(arg<int>(policy::long_name<AR_STRING("threads")>,
+                                      policy::env_fallback<AR_STRING("AR_TEST_THREADS")>,
+                                      policy::default_value{1}),
+                             arg<std::string>(policy::long_name<AR_STRING("name")>,
+                                              policy::env_fallback<AR_STRING("AR_TEST_NAME")>,
+                                              policy::default_value{"dave"s}),
+                             policy::router{[&](int threads, std::string name) {
+                                 result = {threads, std::move(name)};
+                             }}),
+                        policy::validation::default_validator);
+
+    auto args = std::vector{"foo"};
+    r.parse(static_cast<int>(args.size()), const_cast<char**>(args.data()));
+    BOOST_CHECK_EQUAL(std::get<0>(result), 3);
+    BOOST_CHECK_EQUAL(std::get<1>(result), "carol");
+
+    const auto env = scoped_env{"AR_TEST_THREADS", "4"};
+    r.parse(static_cast<int>(args.size()), const_cast<char**>(args.data()));
+    BOOST_CHECK_EQUAL(std::get<0>(result), 4);
+    BOOST_CHECK_EQUAL(std::get<1>(result), "carol");
+
+    args = std::vector{"foo", "--threads", "5", "--name", "erin"};
+    r.parse(static_cast<int>(args.size()), const_cast<char**>(args.data()));
+    BOOST_CHECK_EQUAL(std::get<0>(result), 5);
+    BOOST_CHECK_EQUAL(std::get<1>(result), "erin");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -32,6 +32,9 @@ BOOST_AUTO_TEST_CASE(traits_test)
     static_assert(traits::has_translate_exception_method_v<
                       policy::exception_translator_t<default_error_code_translations, void>>,
                   "Policy test has failed");
+    static_assert(traits::has_translate_method_v<
+                      policy::exception_translator_t<default_error_code_translations, void>>,
+                  "Policy test has failed");
     static_assert(traits::has_error_code_translations_type_v<default_error_code_translations>,
                   "Policy test has failed");
 }
@@ -135,6 +138,27 @@ BOOST_AUTO_TEST_CASE(fallback_test)
         });
 }
 
+BOOST_AUTO_TEST_CASE(translate_test)
+{
+    const auto et =
+        policy::exception_translator<empty_translations, default_error_code_translations>;
+    auto f = [&](const auto& ml_e, auto expected_message) {
+        const auto e = et.translate(ml_e);
+        BOOST_CHECK_EQUAL(e.what(), expected_message);
+    };
+
+    test::data_set(
+        f,
+        {
+            std::tuple{test::create_exception(error_code::unknown_argument, {"--foo"}),
+                       "Unknown argument: --foo"},
+            std::tuple{test::create_exception(error_code::no_arguments_passed),
+                       "No arguments passed"},
+            std::tuple{test::create_exception(static_cast<error_code>(1048), {"--foo"}),
+                       "Untranslated error code (1048): --foo"},
+        });
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,183 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "arg_router/policy/lazy_value.hpp"
+#include "arg_router/arg.hpp"
+#include "arg_router/flag.hpp"
+#include "arg_router/mode.hpp"
+#include "arg_router/multi_arg.hpp"
+#include "arg_router/policy/custom_parser.hpp"
+#include "arg_router/policy/default_value.hpp"
+#include "arg_router/policy/long_name.hpp"
+#include "arg_router/policy/min_max_value.hpp"
+#include "arg_router/policy/router.hpp"
+#include "arg_router/policy/validator.hpp"
+#include "arg_router/root.hpp"
+#include "arg_router/utility/compile_time_string.hpp"
+
+#include "test_helpers.hpp"
+#include "test_printers.hpp"
+
+using namespace arg_router;
+using namespace std::string_view_literals;
+
+BOOST_AUTO_TEST_SUITE(policy_suite)
+
+BOOST_AUTO_TEST_SUITE(lazy_value_suite)
+
+BOOST_AUTO_TEST_CASE(is_policy_test)
+{
+    static_assert(policy::is_policy_v<policy::lazy_value_t<>>, "Policy test has failed");
+}
+
+BOOST_AUTO_TEST_CASE(value_type_test)
+{
+    static_assert(std::is_same_v<typename decltype(arg<int>(policy::long_name<AR_STRING("arg")>,
+                                                            policy::lazy_value))::value_type,
+                                 utility::lazy<int>>,
+                  "Value type test has failed");
+    static_assert(std::is_same_v<typename decltype(arg<int>(
+                                     policy::long_name<AR_STRING("arg")>))::value_type,
+                                 int>,
+                  "Value type test has failed");
+}
+
+BOOST_AUTO_TEST_CASE(deferred_conversion_test)
+{
+    auto num_conversions = 0;
+    auto use_value = false;
+    auto result = std::optional<int>{};
+    const auto r = root(mode(flag(policy::long_name<AR_STRING("flag1")>),
+                             arg<int>(policy::long_name<AR_STRING("arg1")>,
+                                      policy::lazy_value,
+                                      policy::custom_parser<int>{[&](auto str) {
+                                          ++num_conversions;
+                                          return parser<int>::parse(str);
+                                      }}),
+                             policy::router{[&](bool, const utility::lazy<int>& arg1) {
+                                 BOOST_CHECK(!arg1.has_value());
+                                 if (use_value) {
+                                     result = arg1.get();
+                                     result = *arg1;
+                                     BOOST_CHECK(arg1.has_value());
+                                 }
+                             }}),
+                        policy::validation::default_validator);
+
+    r.parse(vector<parsing::token_type>{{parsing::prefix_type::none, "--arg1"},
+                                        {parsing::prefix_type::none, "42"}});
+    BOOST_CHECK_EQUAL(num_conversions, 0);
+    BOOST_CHECK(!result);
+
+    use_value = true;
+    r.parse(vector<parsing::token_type>{{parsing::prefix_type::none, "--arg1"},
+                                        {parsing::prefix_type::none, "42"}});
+    BOOST_CHECK_EQUAL(num_conversions, 1);
+    BOOST_REQUIRE(result);
+    BOOST_CHECK_EQUAL(*result, 42);
+}
+
+BOOST_AUTO_TEST_CASE(deferred_validation_test)
+{
+    auto use_value = false;
+    const auto r = root(mode(arg<int>(policy::long_name<AR_STRING("arg1")>,
+                                      policy::lazy_value,
+                                      policy::min_max_value<1, 10>()),
+                             policy::router{[&](utility::lazy<int> arg1) {
+                                 if (use_value) {
+                                     [[maybe_unused]] const auto& value = arg1.get();
+                                 }
+                             }}),
+                        policy::validation::default_validator);
+
+    auto f = [&](auto tokens, auto use, auto expected_error) {
+        use_value = use;
+
+        auto args = vector<parsing::token_type>{};
+        for (auto token : tokens) {
+            args.emplace_back(parsing::prefix_type::none, token);
+        }
+
+        const auto result = r.try_parse(std::move(args));
+        const auto* e = result.get_error_if();
+        BOOST_CHECK_EQUAL(e ? std::string_view{e->what()} : ""sv, expected_error);
+    };
+
+    test::data_set(
+        f,
+        {
+            std::tuple{std::vector{"--arg1", "5"}, true, ""sv},
+            std::tuple{std::vector{"--arg1", "42"}, false, ""sv},
+            std::tuple{std::vector{"--arg1", "foo"}, false, ""sv},
+            std::tuple{std::vector{"--arg1", "42"}, true, "Maximum value exceeded: --arg1"sv},
+            std::tuple{std::vector{"--arg1", "foo"}, true, "Failed to parse: foo"sv},
+        });
+}
+
+BOOST_AUTO_TEST_CASE(default_value_test)
+{
+    auto result = std::optional<int>{};
+    const auto r = root(mode(flag(policy::long_name<AR_STRING("flag1")>),
+                             arg<int>(policy::long_name<AR_STRING("arg1")>,
+                                      policy::lazy_value,
+                                      policy::default_value{3}),
+                             policy::router{[&](bool, utility::lazy<int> arg1) {
+                                 // Default values do not need converting
+                                 BOOST_CHECK(arg1.has_value());
+                                 result = arg1.get();
+                             }}),
+                        policy::validation::default_validator);
+
+    r.parse(vector<parsing::token_type>{{parsing::prefix_type::none, "--flag1"}});
+    BOOST_REQUIRE(result);
+    BOOST_CHECK_EQUAL(*result, 3);
+}
+
+BOOST_AUTO_TEST_CASE(multi_arg_test)
+{
+    auto result = std::vector<int>{};
+    const auto r =
+        root(mode(multi_arg<std::vector<int>>(policy::long_name<AR_STRING("arg1")>,
+                                              policy::lazy_value),
+                  policy::router{[&](utility::lazy<std::vector<int>> arg1) { result = *arg1; }}),
+             policy::validation::default_validator);
+
+    r.parse(vector<parsing::token_type>{{parsing::prefix_type::none, "--arg1"},
+                                        {parsing::prefix_type::none, "1"},
+                                        {parsing::prefix_type::none, "2"},
+                                        {parsing::prefix_type::none, "3"}});
+    BOOST_CHECK_EQUAL(result, (std::vector{1, 2, 3}));
+}
+
+BOOST_AUTO_TEST_SUITE(death_suite)
+
+BOOST_AUTO_TEST_CASE(flag_test)
+{
+    test::death_test_compile(
+        R"(
+#include "arg_router/flag.hpp"
+#include "arg_router/mode.hpp"
+#include "arg_router/policy/lazy_value.hpp"
+#include "arg_router/policy/long_name.hpp"
+#include "arg_router/policy/router.hpp"
+#include "arg_router/policy/validator.hpp"
+#include "arg_router/root.hpp"
+
+using namespace arg_router;
+
+int main() {
+    const auto r = root(mode(flag(policy::long_name<AR_STRING("flag1")>, policy::lazy_value),
+                             policy::router{[](bool) {}}),
+                        policy::validation::default_validator);
+    return 0;
+}
+    )",
+        "T must have none of these policies");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
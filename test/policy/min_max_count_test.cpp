@@ -64,12 +64,13 @@ BOOST_AUTO_TEST_CASE(count_test)
 BOOST_AUTO_TEST_CASE(pre_parse_phase_test)
 {
     auto f = [&](const auto& policy,
-                 auto result,
-                 auto args,
+                 auto initial_result,
+                 parsing::token_list args,
                  auto expected_result,
                  auto expected_args,
                  auto ec,
                  const auto&... parents) {
+        auto result = parsing::token_buffer(initial_result.begin(), initial_result.end());
         auto node = stub_node{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto processed_target = utility::compile_time_optional{parsing::parse_target{parents...}};
@@ -77,6 +78,7 @@ BOOST_AUTO_TEST_CASE(pre_parse_phase_test)
         try {
             const auto match =
                 policy.pre_parse_phase(adapter, processed_target, target, parents...);
+            adapter.commit();
             BOOST_CHECK_EQUAL(match.get(), parsing::pre_parse_action::valid_node);
             BOOST_CHECK(!ec);
             BOOST_CHECK_EQUAL(result, expected_result);
@@ -408,13 +410,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<1, typename stub_node::policies_type>;
 
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto processed_target =
             utility::compile_time_optional{parsing::parse_target{parents...}};
@@ -430,7 +432,7 @@ int main() {
     const auto parent = stub_node{policy::long_name<AR_STRING("parent")>,
                                   stub_node{policy::long_name<AR_STRING("test")>,
                                             policy::fixed_count<1>}};
-    auto tokens = vector<parsing::token_type>{
+    auto tokens = parsing::token_buffer{
                     {parsing::prefix_type::long_, "hello"}};
     std::get<0>(parent.children()).pre_parse_phase(tokens, parent);
     return 0;
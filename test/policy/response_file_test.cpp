@@ -0,0 +1,135 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "arg_router/policy/response_file.hpp"
+#include "arg_router/arg.hpp"
+#include "arg_router/flag.hpp"
+#include "arg_router/mode.hpp"
+#include "arg_router/policy/validator.hpp"
+#include "arg_router/positional_arg.hpp"
+#include "arg_router/root.hpp"
+
+#include "test_helpers.hpp"
+#include "test_printers.hpp"
+
+using namespace arg_router;
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+namespace
+{
+using result_type = std::tuple<bool, int, std::vector<std::string>>;
+
+// The placeholder is replaced with the response file token
+constexpr auto file_placeholder = "<file>"sv;
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(policy_suite)
+
+BOOST_AUTO_TEST_SUITE(response_file_suite)
+
+BOOST_AUTO_TEST_CASE(is_policy_test)
+{
+    static_assert(policy::is_policy_v<policy::response_file_t<AR_STRING('@')>>,
+                  "Policy test has failed");
+}
+
+BOOST_AUTO_TEST_CASE(response_file_prefix_test)
+{
+    static_assert(std::decay_t<decltype(policy::response_file<>)>::response_file_prefix() == "@",
+                  "Prefix test has failed");
+    static_assert(std::decay_t<decltype(policy::response_file<'+'>)>::response_file_prefix() ==
+                      "+",
+                  "Prefix test has failed");
+    static_assert(std::decay_t<decltype(policy::response_file_utf8<AR_STRING("::")>)>::
+                          response_file_prefix() == "::",
+                  "Prefix test has failed");
+}
+
+BOOST_AUTO_TEST_CASE(parse_test)
+{
+    auto router_hit = false;
+    auto result = result_type{};
+    const auto r = root(policy::response_file<>,
+                        mode(flag(policy::long_name<AR_STRING("flag")>, policy::short_name<'f'>),
+                             arg<int>(policy::long_name<AR_STRING("arg")>,
+                                      policy::default_value{0}),
+                             positional_arg<std::vector<std::string_view>>(
+                                 policy::display_name<AR_STRING("files")>),
+                             policy::router{[&](bool flag, int arg, auto files) {
+                                 // The tokens view the mapping, which is only valid until the
+                                 // router returns
+                                 result = {flag, arg, {files.begin(), files.end()}};
+                                 router_hit = true;
+                             }}),
+                        policy::validation::default_validator);
+
+    auto f = [&](auto contents, auto args, auto expected, std::string fail_message) {
+        const auto tmp = test::temp_file{contents};
+        const auto file_token = "@"s + tmp.path();
+
+        auto c_args = std::vector<const char*>{};
+        for (const auto& arg : args) {
+            c_args.push_back(arg == file_placeholder ? file_token.c_str() : arg.data());
+        }
+
+        result = {};
+        router_hit = false;
+        try {
+            r.parse(static_cast<int>(c_args.size()), const_cast<char**>(c_args.data()));
+            BOOST_CHECK(fail_message.empty());
+            BOOST_CHECK(router_hit);
+            BOOST_CHECK_EQUAL(std::get<0>(result), std::get<0>(expected));
+            BOOST_CHECK_EQUAL(std::get<1>(result), std::get<1>(expected));
+            BOOST_CHECK_EQUAL_COLLECTIONS(std::get<2>(result).begin(),
+                                          std::get<2>(result).end(),
+                                          std::get<2>(expected).begin(),
+                                          std::get<2>(expected).end());
+        } catch (parse_exception& e) {
+            BOOST_CHECK_EQUAL(fail_message, e.what());
+            BOOST_CHECK(!router_hit);
+        }
+    };
+
+    test::data_set(
+        f,
+        {
+            std::tuple{""sv,
+                       std::vector<std::string_view>{"foo", "--flag"},
+                       result_type{true, 0, {}},
+                       ""},
+            std::tuple{"--flag --arg 42"sv,
+                       std::vector<std::string_view>{"foo", file_placeholder},
+                       result_type{true, 42, {}},
+                       ""},
+            std::tuple{"--arg 42\na.txt 'b c.txt'\n"sv,
+                       std::vector<std::string_view>{"foo", "-f", file_placeholder, "d.txt"},
+                       result_type{true, 42, {"a.txt", "b c.txt", "d.txt"}},
+                       ""},
+            std::tuple{""sv,
+                       std::vector<std::string_view>{"foo", file_placeholder, "--flag"},
+                       result_type{true, 0, {}},
+                       ""},
+            std::tuple{"--arg\0" "7\0a b.txt\0"sv,
+                       std::vector<std::string_view>{"foo", file_placeholder},
+                       result_type{false, 7, {"a b.txt"}},
+                       ""},
+            std::tuple{"--arg \"42"sv,
+                       std::vector<std::string_view>{"foo", file_placeholder},
+                       result_type{},
+                       "Unterminated quote"},
+            std::tuple{"--arg 42"sv,
+                       std::vector<std::string_view>{"foo", "@/this/file/does/not/exist"},
+                       result_type{},
+                       "Cannot read response file: @/this/file/does/not/exist"},
+            std::tuple{"--arg 42"sv,
+                       std::vector<std::string_view>{"foo", "@"},
+                       result_type{false, 0, {"@"}},
+                       ""},
+        });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
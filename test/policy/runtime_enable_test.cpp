@@ -50,9 +50,9 @@ BOOST_AUTO_TEST_CASE(type_test)
 BOOST_AUTO_TEST_CASE(pre_parse_phase_test)
 {
     auto f = [&](auto is_required, auto enabled) {
-        auto unprocessed = std::vector<parsing::token_type>{};
-        auto processed = std::vector<parsing::token_type>{};
-        auto tokens = parsing::dynamic_token_adapter{unprocessed, unprocessed};
+        auto unprocessed = parsing::token_list{};
+        auto processed = parsing::token_buffer{};
+        auto tokens = parsing::dynamic_token_adapter{processed, unprocessed};
 
         auto node = stub_node{};
         auto target = parsing::parse_target{node};
@@ -130,9 +130,9 @@ public:
         using this_policy =
             std::tuple_element_t<1, typename stub_node::policies_type>;
 
-        auto unprocessed = std::vector<parsing::token_type>{};
-        auto processed = std::vector<parsing::token_type>{};
-        auto tokens = parsing::dynamic_token_adapter{unprocessed, unprocessed};
+        auto unprocessed = parsing::token_list{};
+        auto processed = parsing::token_buffer{};
+        auto tokens = parsing::dynamic_token_adapter{processed, unprocessed};
 
         auto target = parsing::parse_target{*this};
 
@@ -178,9 +178,9 @@ public:
         using this_policy =
             std::tuple_element_t<2, typename stub_node::policies_type>;
 
-        auto unprocessed = std::vector<parsing::token_type>{};
-        auto processed = std::vector<parsing::token_type>{};
-        auto tokens = parsing::dynamic_token_adapter{unprocessed, unprocessed};
+        auto unprocessed = parsing::token_list{};
+        auto processed = parsing::token_buffer{};
+        auto tokens = parsing::dynamic_token_adapter{processed, unprocessed};
 
         auto target = parsing::parse_target{*this};
 
@@ -43,18 +43,20 @@ BOOST_AUTO_TEST_CASE(is_policy_test)
 
 BOOST_AUTO_TEST_CASE(pre_parse_phase_test)
 {
-    auto f = [](auto result,
-                auto args,
+    auto f = [](auto initial_result,
+                parsing::token_list args,
                 auto expected_result,
                 auto expected_args,
                 const auto&... parents) {
         const auto policy = policy::short_form_expander;
+        auto result = parsing::token_buffer(initial_result.begin(), initial_result.end());
         auto node = stub_node{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto processed_target = utility::compile_time_optional{};
         auto target = parsing::parse_target{node};
 
         const auto match = policy.pre_parse_phase(adapter, processed_target, target, parents...);
+        adapter.commit();
         BOOST_CHECK_EQUAL(result, expected_result);
         BOOST_CHECK_EQUAL(match, parsing::pre_parse_action::valid_node);
         BOOST_CHECK_EQUAL(args, expected_args);
@@ -141,6 +143,57 @@ BOOST_AUTO_TEST_CASE(pre_parse_phase_test)
         });
 }
 
+BOOST_AUTO_TEST_CASE(pre_parse_phase_with_parent_test)
+{
+    const auto owner = stub_node{policy::short_name<'a'>};
+    const auto parent = stub_node{stub_node{policy::short_name<'a'>},
+                                  stub_node{policy::short_name<'b'>},
+                                  stub_node{policy::short_name<'c'>}};
+
+    auto f = [&](parsing::token_list args,
+                 auto expected_result,
+                 auto expected_args,
+                 std::optional<error_code> expected_error) {
+        const auto policy = policy::short_form_expander;
+        auto result = parsing::token_buffer{};
+        auto adapter = parsing::dynamic_token_adapter{result, args};
+        auto processed_target = utility::compile_time_optional{};
+        auto target = parsing::parse_target{owner};
+
+        const auto match =
+            policy.pre_parse_phase(adapter, processed_target, target, owner, parent);
+        if (expected_error) {
+            BOOST_CHECK(!match);
+            try {
+                match.throw_exception();
+                BOOST_CHECK(false);
+            } catch (multi_lang_exception& e) {
+                BOOST_CHECK(e.ec() == *expected_error);
+            }
+        } else {
+            BOOST_CHECK_EQUAL(match, parsing::pre_parse_action::valid_node);
+            adapter.commit();
+        }
+
+        BOOST_CHECK_EQUAL(result, expected_result);
+        BOOST_CHECK_EQUAL(args, expected_args);
+    };
+
+    test::data_set(
+        f,
+        {
+            std::tuple{std::vector<parsing::token_type>{{parsing::prefix_type::none, "-acb"}},
+                       std::vector<parsing::token_type>{{parsing::prefix_type::short_, "a"}},
+                       std::vector<parsing::token_type>{{parsing::prefix_type::short_, "c"},
+                                                        {parsing::prefix_type::short_, "b"}},
+                       std::optional<error_code>{}},
+            std::tuple{std::vector<parsing::token_type>{{parsing::prefix_type::none, "-abz"}},
+                       std::vector<parsing::token_type>{{parsing::prefix_type::short_, "a"}},
+                       std::vector<parsing::token_type>{{parsing::prefix_type::none, "-abz"}},
+                       std::optional<error_code>{error_code::unknown_argument_with_suggestion}},
+        });
+}
+
 BOOST_AUTO_TEST_CASE(death_test)
 {
     test::death_test_compile({{
@@ -165,13 +218,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         [[maybe_unused]] const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<0, typename stub_node::policies_type>;
 
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto processed_target = utility::compile_time_optional{};
         auto target = parsing::parse_target{*this, parents...};
@@ -186,7 +239,7 @@ public:
 
 int main() {
     const auto node = stub_node{policy::short_form_expander};
-    auto tokens = vector<parsing::token_type>{
+    auto tokens = parsing::token_buffer{
                     {parsing::prefix_type::long_, "hello"}};
     node.pre_parse_phase(tokens);
     return 0;
@@ -221,13 +274,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         [[maybe_unused]] const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<0, typename stub_node::policies_type>;
 
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto processed_target = utility::compile_time_optional{};
         auto target = parsing::parse_target{*this, parents...};
@@ -244,7 +297,7 @@ int main() {
     const auto node = stub_node{policy::short_form_expander,
                                 policy::long_name<AR_STRING("hello")>,
                                 policy::short_name<'H'>};
-    auto tokens = vector<parsing::token_type>{
+    auto tokens = parsing::token_buffer{
                     {parsing::prefix_type::long_, "hello"}};
     node.pre_parse_phase(tokens);
     return 0;
@@ -64,9 +64,12 @@ BOOST_AUTO_TEST_CASE(string_literal_test)
 
 BOOST_AUTO_TEST_CASE(pre_parse_phase_test)
 {
-    auto f = [&](auto args, auto expected_result, auto expected_args, const auto&... parents) {
+    auto f = [&](parsing::token_list args,
+                 auto expected_result,
+                 auto expected_args,
+                 const auto&... parents) {
         auto node = stub_node{};
-        auto result = std::vector<parsing::token_type>{};
+        auto result = parsing::token_buffer{};
 
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto processed_target = utility::compile_time_optional{parsing::parse_target{parents...}};
@@ -77,6 +80,7 @@ BOOST_AUTO_TEST_CASE(pre_parse_phase_test)
                                                                       processed_target,
                                                                       target,
                                                                       parents...);
+        adapter.commit();
         BOOST_CHECK_EQUAL(match.get(), parsing::pre_parse_action::valid_node);
         BOOST_CHECK_EQUAL(result, expected_result);
         BOOST_CHECK_EQUAL(args, expected_args);
@@ -179,13 +183,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<0, typename stub_node::policies_type>;
 
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto processed_target =
             utility::compile_time_optional{parsing::parse_target{parents...}};
@@ -206,7 +210,7 @@ public:
 
 int main() {
     const auto parent = stub_node{policy::token_end_marker<AR_STRING("--")>};
-    auto tokens = vector<parsing::token_type>{
+    auto tokens = parsing::token_buffer{
                     {parsing::prefix_type::long_, "hello"}};
     parent.pre_parse_phase(tokens, parent);
     return 0;
@@ -237,13 +241,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<0, typename stub_node::policies_type>;
 
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto processed_target =
             utility::compile_time_optional{parsing::parse_target{parents...}};
@@ -265,7 +269,7 @@ public:
 int main() {
     const auto parent = stub_node{policy::token_end_marker<AR_STRING("--")>,
                                   policy::fixed_count<1>};
-    auto tokens = vector<parsing::token_type>{
+    auto tokens = parsing::token_buffer{
                     {parsing::prefix_type::long_, "hello"}};
     parent.pre_parse_phase(tokens, parent);
     return 0;
@@ -297,13 +301,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<0, typename stub_node::policies_type>;
 
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto processed_target =
             utility::compile_time_optional{parsing::parse_target{parents...}};
@@ -325,7 +329,7 @@ public:
 int main() {
     const auto parent = stub_node{policy::token_end_marker<AR_STRING("--")>,
                                   policy::multi_stage_value<int, bool>{[](auto&, auto&&){}}};
-    auto tokens = vector<parsing::token_type>{
+    auto tokens = parsing::token_buffer{
                     {parsing::prefix_type::long_, "hello"}};
     parent.pre_parse_phase(tokens, parent);
     return 0;
@@ -67,19 +67,21 @@ BOOST_AUTO_TEST_CASE(string_literal_test)
 
 BOOST_AUTO_TEST_CASE(pre_parse_phase_test)
 {
-    auto f = [](auto result,
-                auto args,
+    auto f = [](auto initial_result,
+                parsing::token_list args,
                 auto expected_result,
                 auto expected_match,
                 auto expected_args,
                 const auto&... parents) {
         const auto policy = policy::value_separator<'='>;
+        auto result = parsing::token_buffer(initial_result.begin(), initial_result.end());
         auto node = stub_node{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto processed_target = utility::compile_time_optional{};
         auto target = parsing::parse_target{node};
 
         const auto match = policy.pre_parse_phase(adapter, processed_target, target, parents...);
+        adapter.commit();
         if constexpr (std::is_same_v<parsing::pre_parse_action, decltype(expected_match)>) {
             BOOST_CHECK_EQUAL(match, expected_match);
         } else {
@@ -236,13 +238,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         [[maybe_unused]] const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<1, typename stub_node::policies_type>;
 
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto processed_target = utility::compile_time_optional{};
         auto target = parsing::parse_target{*this, parents...};
@@ -256,7 +258,7 @@ public:
 int main() {
     const auto node = stub_node{policy::long_name<AR_STRING("test")>,
                                 policy::value_separator<'='>};
-    auto tokens = vector<parsing::token_type>{
+    auto tokens = parsing::token_buffer{
                     {parsing::prefix_type::long_, "hello"},
                     {parsing::prefix_type::none, "42"}};
     node.pre_parse_phase(tokens);
@@ -288,13 +290,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         [[maybe_unused]] const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<1, typename stub_node::policies_type>;
 
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto processed_target = utility::compile_time_optional{};
         auto target = parsing::parse_target{*this, parents...};
@@ -310,7 +312,7 @@ public:
 int main() {
     const auto node = stub_node{policy::long_name<AR_STRING("hello")>,
                                 policy::value_separator<'='>};
-    auto tokens = vector<parsing::token_type>{
+    auto tokens = parsing::token_buffer{
                     {parsing::prefix_type::long_, "hello"}};
     node.pre_parse_phase(tokens);
     return 0;
@@ -343,13 +345,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         [[maybe_unused]] const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<2, typename stub_node::policies_type>;
 
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto processed_target = utility::compile_time_optional{};
         auto target = parsing::parse_target{*this, parents...};
@@ -366,7 +368,7 @@ int main() {
     const auto node = stub_node{policy::long_name<AR_STRING("hello")>,
                                 policy::max_count<3>,
                                 policy::value_separator<'='>};
-    auto tokens = vector<parsing::token_type>{
+    auto tokens = parsing::token_buffer{
                     {parsing::prefix_type::long_, "hello"}};
     node.pre_parse_phase(tokens);
     return 0;
@@ -399,13 +401,13 @@ public:
 
     template <typename... Parents>
     void pre_parse_phase(
-        vector<parsing::token_type>& result,
+        parsing::token_buffer& result,
         [[maybe_unused]] const Parents&... parents) const
     {
         using this_policy =
             std::tuple_element_t<2, typename stub_node::policies_type>;
 
-        auto args = vector<parsing::token_type>{};
+        auto args = parsing::token_list{};
         auto adapter = parsing::dynamic_token_adapter{result, args};
         auto processed_target = utility::compile_time_optional{};
         auto target = parsing::parse_target{*this, parents...};
@@ -422,7 +424,7 @@ int main() {
     const auto node = stub_node{policy::long_name<AR_STRING("hello")>,
                                 policy::fixed_count<3>,
                                 policy::value_separator<'='>};
-    auto tokens = vector<parsing::token_type>{
+    auto tokens = parsing::token_buffer{
                     {parsing::prefix_type::long_, "hello"}};
     node.pre_parse_phase(tokens);
     return 0;
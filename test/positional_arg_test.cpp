@@ -27,7 +27,8 @@ BOOST_AUTO_TEST_CASE(is_tree_node_test)
 BOOST_AUTO_TEST_CASE(parse_test)
 {
     auto f = [](const auto& node, auto tokens, auto expected_result) {
-        auto target = parsing::parse_target{std::move(tokens), node};
+        auto target =
+            parsing::parse_target{parsing::token_buffer(tokens.begin(), tokens.end()), node};
         const auto result = node.parse(std::move(target));
         BOOST_CHECK_EQUAL(result, expected_result);
     };
@@ -0,0 +1,218 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// This is built as a separate executable, as changing AR_ALLOCATOR changes the layout of
+// non-template types and so it cannot be mixed with the other tests
+#undef AR_ALLOCATOR
+#define AR_ALLOCATOR arg_router::utility::resource_allocator
+
+#define BOOST_TEST_MODULE arg_router_resource_test Test Suite
+#include <boost/test/included/unit_test.hpp>
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+std::size_t global_allocations = 0;
+}  // namespace
+
+// Count all the global heap allocations, so we can check allocations that bypass the resource
+void* operator new(std::size_t count)
+{
+    ++global_allocations;
+    if (auto* p = std::malloc(count == 0 ? 1 : count)) {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, [[maybe_unused]] std::size_t count) noexcept
+{
+    std::free(p);
+}
+
+#include "arg_router/arg.hpp"
+#include "arg_router/flag.hpp"
+#include "arg_router/mode.hpp"
+#include "arg_router/multi_arg.hpp"
+#include "arg_router/policy/config_file.hpp"
+#include "arg_router/policy/lazy_value.hpp"
+#include "arg_router/policy/validator.hpp"
+#include "arg_router/positional_arg.hpp"
+#include "arg_router/root.hpp"
+
+#include "test_helpers.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+using namespace arg_router;
+using namespace std::string_view_literals;
+
+BOOST_AUTO_TEST_SUITE(resource_parse_suite)
+
+BOOST_AUTO_TEST_CASE(no_global_allocations_test)
+{
+    auto result = std::tuple<bool, int, bool, std::size_t>{};
+    const auto r =
+        root(mode(flag(policy::long_name<AR_STRING("flag1")>),
+                  arg<int>(policy::long_name<AR_STRING("arg1")>, policy::default_value{1}),
+                  arg<string>(policy::long_name<AR_STRING("arg2")>, policy::required),
+                  positional_arg<vector<std::string_view>>(policy::display_name<AR_STRING("pos")>),
+                  policy::router{[&](bool flag1, int arg1, string arg2, auto pos) {
+                      result = {flag1, arg1, arg2 == "hello", pos.size()};
+                  }}),
+             policy::validation::default_validator);
+
+    auto f = [&](auto args, auto expected) {
+        // The backing buffer has no upstream, so exceeding it is an error rather than falling back
+        // to the heap
+        auto buffer = std::vector<std::byte>(64 * 1024);
+        auto backing = std::pmr::monotonic_buffer_resource{buffer.data(),
+                                                           buffer.size(),
+                                                           std::pmr::null_memory_resource()};
+        auto resource = test::counting_resource{&backing};
+        result = {};
+
+        const auto global_allocations_before = global_allocations;
+        r.parse(static_cast<int>(args.size()), const_cast<char**>(args.data()), resource);
+        const auto global_allocations_after = global_allocations;
+
+        BOOST_CHECK_EQUAL(global_allocations_after - global_allocations_before, 0u);
+        BOOST_CHECK_GT(resource.allocated_bytes, 0u);
+        BOOST_CHECK_EQUAL(resource.current_bytes, 0u);
+        BOOST_CHECK_EQUAL(std::get<0>(result), std::get<0>(expected));
+        BOOST_CHECK_EQUAL(std::get<1>(result), std::get<1>(expected));
+        BOOST_CHECK(std::get<2>(result));
+        BOOST_CHECK_EQUAL(std::get<3>(result), std::get<2>(expected));
+    };
+
+    auto many_args = std::vector{"foo", "--arg2", "hello"};
+    for (auto i = 0; i < 100; ++i) {
+        many_args.push_back("pos");
+    }
+
+    test::data_set(
+        f,
+        {
+            std::tuple{std::vector{"foo", "--arg2", "hello"}, std::tuple{false, 1, 0u}},
+            std::tuple{std::vector{"foo", "--flag1", "--arg1", "42", "--arg2", "hello", "a", "b"},
+                       std::tuple{true, 42, 2u}},
+            std::tuple{many_args, std::tuple{false, 1, 100u}},
+        });
+}
+
+BOOST_AUTO_TEST_CASE(no_global_allocations_on_error_test)
+{
+    const auto r = root(mode(arg<int>(policy::long_name<AR_STRING("arg1")>, policy::required),
+                             policy::router{[](int) {}}),
+                        policy::validation::default_validator);
+
+    auto f = [&](auto args, std::string_view fail_message) {
+        auto buffer = std::vector<std::byte>(64 * 1024);
+        auto backing = std::pmr::monotonic_buffer_resource{buffer.data(),
+                                                           buffer.size(),
+                                                           std::pmr::null_memory_resource()};
+        auto resource = test::counting_resource{&backing};
+        {
+            const auto global_allocations_before = global_allocations;
+            const auto result = r.try_parse(static_cast<int>(args.size()),
+                                            const_cast<char**>(args.data()),
+                                            resource);
+            const auto global_allocations_after = global_allocations;
+
+            BOOST_CHECK_EQUAL(global_allocations_after - global_allocations_before, 0u);
+            BOOST_REQUIRE(result.has_error());
+            BOOST_CHECK_EQUAL(result.get_error_if()->what(), fail_message);
+        }
+        BOOST_CHECK_EQUAL(resource.current_bytes, 0u);
+    };
+
+    test::data_set(f,
+                   {
+                       std::tuple{std::vector{"foo", "--arg1", "abc"}, "Failed to parse: abc"sv},
+                       std::tuple{std::vector{"foo"}, "Missing required argument: --arg1"sv},
+                       std::tuple{std::vector{"foo", "--unknown"},
+                                  "Unknown argument: --unknown. Did you mean --arg1?"sv},
+                   });
+}
+
+BOOST_AUTO_TEST_CASE(lazy_value_test)
+{
+    auto result = std::tuple<int, std::size_t>{};
+    const auto r =
+        root(mode(arg<int>(policy::long_name<AR_STRING("arg1")>, policy::lazy_value),
+                  multi_arg<vector<int>>(policy::long_name<AR_STRING("arg2")>, policy::lazy_value),
+                  policy::router{[&](const utility::lazy<int>& arg1,
+                                     const utility::lazy<vector<int>>& arg2) {
+                      result = {arg1.get(), arg2->size()};
+                  }}),
+             policy::validation::default_validator);
+
+    auto buffer = std::vector<std::byte>(64 * 1024);
+    auto backing = std::pmr::monotonic_buffer_resource{buffer.data(),
+                                                       buffer.size(),
+                                                       std::pmr::null_memory_resource()};
+    auto resource = test::counting_resource{&backing};
+
+    // The deferred conversion holds the tokens and the node, so it does not need the heap
+    auto args = std::vector{"foo", "--arg1", "42", "--arg2", "1", "2", "3", "4"};
+    const auto global_allocations_before = global_allocations;
+    r.parse(static_cast<int>(args.size()), const_cast<char**>(args.data()), resource);
+    const auto global_allocations_after = global_allocations;
+
+    BOOST_CHECK_EQUAL(global_allocations_after - global_allocations_before, 0u);
+    BOOST_CHECK_EQUAL(resource.current_bytes, 0u);
+    BOOST_CHECK_EQUAL(std::get<0>(result), 42);
+    BOOST_CHECK_EQUAL(std::get<1>(result), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(config_file_test)
+{
+    const auto path =
+        (std::filesystem::temp_directory_path() / "arg_router_resource_parse_test.toml").string();
+    {
+        auto stream = std::ofstream{path};
+        stream << "arg1 = 42\n"
+                  "[mode]\n"
+                  "arg1 = 7\n";
+    }
+
+    auto result = 0;
+    const auto r = root(policy::config_file{path},
+                        mode(arg<int>(policy::long_name<AR_STRING("arg1")>),
+                             policy::router{[&](int arg1) { result = arg1; }}),
+                        policy::validation::default_validator);
+
+    // The config table is built on the first parse, it must not be allocated from that parse's
+    // resource as the resource (and the memory it has handed out) does not outlive the parse
+    for (auto i = 0; i < 3; ++i) {
+        auto buffer = std::vector<std::byte>(64 * 1024);
+        {
+            auto arena = std::pmr::monotonic_buffer_resource{buffer.data(),
+                                                             buffer.size(),
+                                                             std::pmr::null_memory_resource()};
+            auto scoped = test::counting_resource{&arena};
+
+            auto args = std::vector{"foo"};
+            result = 0;
+            r.parse(static_cast<int>(args.size()), const_cast<char**>(args.data()), scoped);
+            BOOST_CHECK_EQUAL(result, 42);
+            BOOST_CHECK_EQUAL(scoped.current_bytes, 0u);
+        }
+
+        // Trash the released memory so any dangling use of it is visible
+        std::fill(buffer.begin(), buffer.end(), std::byte{0xFF});
+    }
+
+    std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -356,6 +356,46 @@ BOOST_AUTO_TEST_CASE(one_of_default_value_test)
                    });
 }
 
+BOOST_AUTO_TEST_CASE(one_of_reuse_test)
+{
+    auto result = std::optional<std::variant<bool, int, std::string_view>>{};
+    const auto r = root(mode(ard::one_of(flag(policy::short_name<'f'>),
+                                         arg<int>(policy::long_name<AR_STRING("arg2")>),
+                                         arg<std::string_view>(
+                                             policy::long_name<AR_STRING("arg3")>),
+                                         policy::required),
+                             policy::router{[&](std::variant<bool, int, std::string_view> of) {
+                                 result = std::move(of);
+                             }}),
+                        policy::validation::default_validator);
+
+    // The same root instance is used for every parse, so the one_of selection must not persist
+    auto f = [&](auto args, auto of_expected, std::string fail_message) {
+        result.reset();
+        try {
+            r.parse(args);
+            BOOST_CHECK(fail_message.empty());
+            BOOST_REQUIRE(!!result);
+            BOOST_CHECK_EQUAL(std::get<decltype(of_expected)>(*result), of_expected);
+        } catch (parse_exception& e) {
+            BOOST_CHECK_EQUAL(fail_message, e.what());
+            BOOST_CHECK(!result);
+        }
+    };
+
+    test::data_set(f,
+                   std::tuple{
+                       std::tuple{std::vector{"-f"}, true, ""},
+                       std::tuple{std::vector{"--arg3", "hello"}, "hello"sv, ""},
+                       std::tuple{std::vector{"--arg2", "42"}, 42, ""},
+                       std::tuple{std::vector{"-f", "--arg2", "42"},
+                                  true,
+                                  "Only one argument from a \"One Of\" can be used at once: "
+                                  "One of: -f,--arg2,--arg3"},
+                       std::tuple{std::vector{"--arg2", "42"}, 42, ""},
+                   });
+}
+
 BOOST_AUTO_TEST_CASE(counting_flag_test)
 {
     auto result = std::optional<  //
@@ -552,6 +592,215 @@ BOOST_AUTO_TEST_CASE(parse_overloads_test)
         });
 }
 
+BOOST_AUTO_TEST_CASE(try_parse_test)
+{
+    auto router_hit = false;
+    auto result = std::tuple{false, 0};
+    const auto r = root(mode(flag(policy::long_name<AR_STRING("flag1")>,
+                                  policy::description<AR_STRING("First description")>),
+                             arg<int>(policy::long_name<AR_STRING("arg1")>,
+                                      policy::required,
+                                      policy::description<AR_STRING("Second description")>),
+                             policy::router{[&](bool flag1, int arg1) {
+                                 result = {flag1, arg1};
+                                 router_hit = true;
+                             }}),
+                        policy::validation::default_validator);
+
+    const auto parse_invocations = std::vector<
+        std::pair<std::string_view,
+                  std::function<utility::result<void, parse_exception>(std::vector<const char*>)>>>{
+        {"vector<parsing::token_type> overload",
+         [&](std::vector<const char*> args) {
+             args.erase(args.begin());
+             auto tt = vector<parsing::token_type>{};
+             for (auto arg : args) {
+                 tt.emplace_back(parsing::prefix_type::none, arg);
+             }
+             return r.try_parse(std::move(tt));
+         }},
+        {"int, char** overload",
+         [&](std::vector<const char*> args) {
+             return r.try_parse(static_cast<int>(args.size()), const_cast<char**>(args.data()));
+         }},
+        {"Iter, Iter overload",
+         [&](std::vector<const char*> args) {  //
+             args.erase(args.begin());
+             return r.try_parse(args.begin(), args.end());
+         }},
+        {"Container overload",
+         [&](std::vector<const char*> args) {  //
+             args.erase(args.begin());
+             return r.try_parse(args);
+         }}};
+
+    auto f = [&](auto args, auto expected, std::string fail_message) {
+        for (const auto& [name, invoc] : parse_invocations) {
+            BOOST_TEST_MESSAGE("\t" << name);
+            result = {false, 0};
+            router_hit = false;
+
+            const auto parse_result = invoc(args);
+            BOOST_CHECK_EQUAL(parse_result.has_error(), !fail_message.empty());
+            if (const auto* e = parse_result.get_error_if()) {
+                BOOST_CHECK_EQUAL(fail_message, e->what());
+                BOOST_CHECK(!router_hit);
+            } else {
+                BOOST_CHECK(router_hit);
+                BOOST_CHECK_EQUAL(std::get<0>(result), std::get<0>(expected));
+                BOOST_CHECK_EQUAL(std::get<1>(result), std::get<1>(expected));
+            }
+        }
+    };
+
+    test::data_set(f,
+                   {
+                       std::tuple{std::vector{"foo", "--arg1", "42"}, std::tuple{false, 42}, ""},
+                       std::tuple{std::vector{"foo", "--flag1", "--arg1", "42"},
+                                  std::tuple{true, 42},
+                                  ""},
+                       std::tuple{std::vector{"foo", "--foo"},
+                                  std::tuple{false, 0},
+                                  "Unknown argument: --foo. Did you mean --flag1?"},
+                       std::tuple{std::vector{"foo", "--flag1"},
+                                  std::tuple{false, 0},
+                                  "Missing required argument: --arg1"},
+                       std::tuple{std::vector{"foo", "--arg1", "bar"},
+                                  std::tuple{false, 0},
+                                  "Failed to parse: bar"},
+                       std::tuple{std::vector{"foo", "--flag1", "--arg1", "1", "--flag1"},
+                                  std::tuple{false, 0},
+                                  "Argument has already been set: --flag1"},
+                   });
+}
+
+BOOST_AUTO_TEST_CASE(parse_batch_test)
+{
+    auto results = std::vector<std::tuple<bool, int>>{};
+    const auto r = root(mode(flag(policy::long_name<AR_STRING("flag1")>,
+                                  policy::description<AR_STRING("First description")>),
+                             arg<int>(policy::long_name<AR_STRING("arg1")>,
+                                      policy::required,
+                                      policy::description<AR_STRING("Second description")>),
+                             policy::router{[&](bool flag1, int arg1) {
+                                 results.emplace_back(flag1, arg1);
+                             }}),
+                        policy::validation::default_validator);
+
+    const auto command_lines = std::vector<std::vector<std::string_view>>{
+        {"--arg1", "1"},
+        {"--flag1", "--arg1", "2"},
+        {"--foo"},
+        {"--flag1"},
+        {"--arg1", "3", "--flag1"},
+    };
+    const auto expected_errors = std::vector<std::string_view>{
+        "",
+        "",
+        "Unknown argument: --foo. Did you mean --flag1?",
+        "Missing required argument: --arg1",
+        "",
+    };
+    const auto expected_results = std::vector<std::tuple<bool, int>>{
+        {false, 1},
+        {true, 2},
+        {true, 3},
+    };
+
+    const auto check = [&](const auto& batch_result) {
+        BOOST_REQUIRE_EQUAL(batch_result.size(), expected_errors.size());
+        for (auto i = 0u; i < batch_result.size(); ++i) {
+            const auto* e = batch_result[i].get_error_if();
+            BOOST_CHECK_EQUAL(e ? std::string_view{e->what()} : ""sv, expected_errors[i]);
+        }
+    };
+
+    check(r.parse_batch(command_lines));
+    BOOST_CHECK(results == expected_results);
+
+    // A custom executor can split the work up however it likes
+    results.clear();
+    auto ranges = std::vector<std::pair<std::size_t, std::size_t>>{};
+    check(r.parse_batch(command_lines, [&](std::size_t count, const auto& work) {
+        for (auto i = 0u; i < count; i += 2) {
+            const auto last = std::min<std::size_t>(i + 2, count);
+            ranges.emplace_back(i, last);
+            work(i, last);
+        }
+    }));
+    BOOST_CHECK(results == expected_results);
+    BOOST_CHECK_EQUAL(ranges.size(), 3);
+
+    BOOST_CHECK(r.parse_batch(std::vector<std::vector<std::string_view>>{}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(parse_command_line_test)
+{
+    auto router_hit = false;
+    auto result = std::tuple<bool, std::string, std::vector<std::string>>{};
+    const auto r = root(mode(flag(policy::long_name<AR_STRING("flag1")>,
+                                  policy::description<AR_STRING("First description")>),
+                             arg<std::string_view>(
+                                 policy::long_name<AR_STRING("arg1")>,
+                                 policy::required,
+                                 policy::description<AR_STRING("Second description")>),
+                             positional_arg<std::vector<std::string_view>>(
+                                 policy::display_name<AR_STRING("pos_args")>,
+                                 policy::description<AR_STRING("Third description")>),
+                             policy::router{[&](bool flag1, auto arg1, auto pos_args) {
+                                 // The escaped tokens are only valid until the parse returns
+                                 result = {flag1,
+                                           std::string{arg1},
+                                           {pos_args.begin(), pos_args.end()}};
+                                 router_hit = true;
+                             }}),
+                        policy::validation::default_validator);
+
+    auto f = [&](std::string_view command_line, auto expected, std::string fail_message) {
+        const auto check = [&](const auto& parse_result) {
+            if (const auto* e = parse_result.get_error_if()) {
+                BOOST_CHECK_EQUAL(fail_message, e->what());
+                BOOST_CHECK(!router_hit);
+            } else {
+                BOOST_CHECK(fail_message.empty());
+                BOOST_CHECK(router_hit);
+                BOOST_CHECK_EQUAL(std::get<0>(result), std::get<0>(expected));
+                BOOST_CHECK_EQUAL(std::get<1>(result), std::get<1>(expected));
+                BOOST_CHECK_EQUAL_COLLECTIONS(std::get<2>(result).begin(),
+                                              std::get<2>(result).end(),
+                                              std::get<2>(expected).begin(),
+                                              std::get<2>(expected).end());
+            }
+        };
+
+        result = {};
+        router_hit = false;
+        check(r.try_parse_command_line(command_line));
+
+        result = {};
+        router_hit = false;
+        try {
+            r.parse_command_line(command_line);
+            check(utility::result<void, parse_exception>{});
+        } catch (parse_exception& e) {
+            check(utility::result<void, parse_exception>{e});
+        }
+    };
+
+    using expected_type = std::tuple<bool, std::string, std::vector<std::string>>;
+    test::data_set(
+        f,
+        {
+            std::tuple{"--arg1 hello"sv, expected_type{false, "hello", {}}, ""},
+            std::tuple{"  --flag1\t--arg1 'hello world' a \"b c\" d\\ e  "sv,
+                       expected_type{true, "hello world", {"a", "b c", "d e"}},
+                       ""},
+            std::tuple{"--flag1"sv, expected_type{}, "Missing required argument: --arg1"},
+            std::tuple{"--arg1 'hello"sv, expected_type{}, "Unterminated quote"},
+            std::tuple{" \t "sv, expected_type{}, "Missing required argument: --arg1"},
+        });
+}
+
 BOOST_AUTO_TEST_CASE(runtime_enable_test)
 {
     auto f =
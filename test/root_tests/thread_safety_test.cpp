@@ -0,0 +1,131 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "arg_router/arg.hpp"
+#include "arg_router/dependency/one_of.hpp"
+#include "arg_router/flag.hpp"
+#include "arg_router/mode.hpp"
+#include "arg_router/policy/default_value.hpp"
+#include "arg_router/policy/long_name.hpp"
+#include "arg_router/policy/required.hpp"
+#include "arg_router/policy/router.hpp"
+#include "arg_router/policy/short_name.hpp"
+#include "arg_router/policy/validator.hpp"
+#include "arg_router/root.hpp"
+#include "arg_router/utility/compile_time_string.hpp"
+
+#include "test_helpers.hpp"
+
+#include <atomic>
+#include <optional>
+#include <thread>
+
+using namespace arg_router;
+namespace ard = arg_router::dependency;
+using namespace std::string_view_literals;
+
+namespace
+{
+using result_type = std::tuple<int, std::variant<bool, int, std::string_view>>;
+
+// Each thread has its own copy, so the router does not need synchronising
+thread_local auto router_result = std::optional<result_type>{};
+
+const auto shared_root =
+    root(mode(arg<int>(policy::long_name<AR_STRING("arg1")>, policy::default_value{42}),
+              ard::one_of(flag(policy::short_name<'f'>),
+                          arg<int>(policy::long_name<AR_STRING("arg2")>),
+                          arg<std::string_view>(policy::long_name<AR_STRING("arg3")>),
+                          policy::required),
+              policy::router{[](int arg1, std::variant<bool, int, std::string_view> of) {
+                  router_result = result_type{arg1, std::move(of)};
+              }}),
+         policy::validation::default_validator);
+
+struct test_case {
+    std::vector<std::string_view> args;
+    std::optional<result_type> expected;
+};
+
+const auto test_cases = std::vector<test_case>{
+    {{"-f"}, result_type{42, true}},
+    {{"--arg1", "13", "--arg2", "7"}, result_type{13, 7}},
+    {{"--arg3", "hello"}, result_type{42, "hello"sv}},
+    {{"-f", "--arg2", "7"}, std::nullopt},
+    {{"--arg1", "13"}, std::nullopt},
+};
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(root_suite)
+
+BOOST_AUTO_TEST_SUITE(thread_safety_suite)
+
+BOOST_AUTO_TEST_CASE(shared_root_test)
+{
+    constexpr auto num_threads = 8u;
+    constexpr auto num_iterations = 500u;
+
+    // Boost.Test assertions are not thread-safe, so just count the failures in the workers
+    auto failures = std::atomic<std::size_t>{0};
+
+    auto workers = std::vector<std::thread>{};
+    workers.reserve(num_threads);
+    for (auto i = 0u; i < num_threads; ++i) {
+        workers.emplace_back([&, i]() {
+            for (auto j = 0u; j < num_iterations; ++j) {
+                // Offset each thread so they are all parsing different inputs at the same time
+                const auto& tc = test_cases[(i + j) % test_cases.size()];
+
+                router_result.reset();
+                const auto result = shared_root.try_parse(tc.args);
+                if ((result.has_result() != !!tc.expected) || (router_result != tc.expected)) {
+                    ++failures;
+                }
+            }
+        });
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    BOOST_CHECK_EQUAL(failures, 0);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_parse_batch_test)
+{
+    constexpr auto num_threads = 4u;
+    constexpr auto num_command_lines = 1000u;
+
+    auto command_lines = std::vector<std::vector<std::string_view>>{};
+    command_lines.reserve(num_command_lines);
+    for (auto i = 0u; i < num_command_lines; ++i) {
+        command_lines.push_back(test_cases[i % test_cases.size()].args);
+    }
+
+    const auto results =
+        shared_root.parse_batch(command_lines, [](std::size_t count, const auto& work) {
+            const auto chunk_size = (count + num_threads - 1) / num_threads;
+
+            auto workers = std::vector<std::thread>{};
+            workers.reserve(num_threads);
+            for (auto first = std::size_t{0}; first < count; first += chunk_size) {
+                workers.emplace_back(
+                    [&, first]() { work(first, std::min(first + chunk_size, count)); });
+            }
+
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        });
+
+    BOOST_REQUIRE_EQUAL(results.size(), command_lines.size());
+    for (auto i = 0u; i < results.size(); ++i) {
+        BOOST_CHECK_EQUAL(results[i].has_result(), !!test_cases[i % test_cases.size()].expected);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
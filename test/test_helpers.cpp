@@ -9,7 +9,9 @@
 #include <boost/process/search_path.hpp>
 #include <boost/process/system.hpp>
 
+#include <atomic>
 #include <bitset>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 
@@ -218,3 +220,23 @@ void test::death_test_compile(std::string_view code, std::string_view expected_e
     compile(0, code, expected_error);
     fs::remove_all(project_repo() / repo_sub_path);
 }
+
+test::temp_file::temp_file(std::string_view contents)
+{
+    static auto counter = std::atomic<std::size_t>{0};
+
+    // The timestamp keeps concurrent test runs apart, the counter keeps files in this run apart
+    const auto stamp = std::chrono::steady_clock::now().time_since_epoch().count();
+    path_ = (fs::temp_directory_path() /
+             ("arg_router_test_"s + std::to_string(stamp) + "_" + std::to_string(counter++)))
+                .string();
+
+    auto stream = std::ofstream{path_, std::ios::binary};
+    stream.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+test::temp_file::~temp_file()
+{
+    auto ec = std::error_code{};
+    fs::remove(path_, ec);
+}
@@ -11,6 +11,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <forward_list>
+#include <memory_resource>
 
 namespace arg_router
 {
@@ -219,5 +220,72 @@ void death_test_compile(std::forward_list<death_test_info> tests);
  * @param expected_error Error string to search for in output
  */
 void death_test_compile(std::string_view code, std::string_view expected_error);
+
+/** A uniquely named file in the system's temporary directory, removed on destruction.
+ */
+class temp_file
+{
+public:
+    /** Constructor.
+     *
+     * @param contents Data written to the file
+     */
+    explicit temp_file(std::string_view contents);
+
+    temp_file(const temp_file&) = delete;
+    temp_file& operator=(const temp_file&) = delete;
+
+    /** Destructor. */
+    ~temp_file();
+
+    /** Returns the file's path.
+     *
+     * @return Path
+     */
+    [[nodiscard]] const std::string& path() const noexcept { return path_; }
+
+private:
+    std::string path_;
+};
+
+/** A memory resource that tracks the number of bytes allocated through it.
+ */
+class counting_resource : public std::pmr::memory_resource
+{
+public:
+    /** Constructor.
+     *
+     * @param upstream Resource to allocate from
+     */
+    explicit counting_resource(
+        std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept :
+        upstream_{upstream}
+    {
+    }
+
+    std::size_t allocated_bytes = 0;  /// Total bytes allocated
+    std::size_t current_bytes = 0;    /// Bytes currently allocated
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        allocated_bytes += bytes;
+        current_bytes += bytes;
+        return upstream_->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+        current_bytes -= bytes;
+        upstream_->deallocate(p, bytes, alignment);
+    }
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    std::pmr::memory_resource* upstream_;
+};
 }  // namespace test
 }  // namespace arg_router
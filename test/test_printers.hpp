@@ -5,6 +5,7 @@
 #pragma once
 
 #include "arg_router/parsing/parsing.hpp"
+#include "arg_router/parsing/token_list.hpp"
 
 #include <boost/test/unit_test.hpp>
 
@@ -25,6 +26,24 @@ inline std::ostream& operator<<(std::ostream& stream, const token_type& token)
     return stream << to_string(token);
 }
 
+inline std::ostream& operator<<(std::ostream& stream, const token_list& tokens)
+{
+    stream << "{";
+    for (const auto& token : tokens) {
+        stream << token << ",";
+    }
+    return stream << "}";
+}
+
+inline std::ostream& operator<<(std::ostream& stream, const token_buffer& tokens)
+{
+    stream << "{";
+    for (const auto& token : tokens) {
+        stream << token << ",";
+    }
+    return stream << "}";
+}
+
 inline std::ostream& operator<<(std::ostream& stream, pre_parse_action action)
 {
     switch (action) {
@@ -53,7 +53,7 @@ public:
     constexpr explicit stub_node(Params... params) : tree_node<Params...>{std::move(params)...} {}
 
     template <typename Validator, bool HasTarget, typename... Parents>
-    std::optional<parsing::parse_target> pre_parse(
+    parsing::pre_parse_target_result pre_parse(
         parsing::pre_parse_data<Validator, HasTarget> pre_parse_data,
         const Parents&... parents) const
     {
@@ -215,7 +215,7 @@ BOOST_AUTO_TEST_CASE(priority_ordered_policies_type_test)
 BOOST_AUTO_TEST_CASE(pre_parse_test)
 {
     auto f = [](const auto& node,
-                auto args,
+                parsing::token_list args,
                 auto expected_tokens,
                 auto expected_sub_target_data,
                 auto expected_args,
@@ -223,7 +223,7 @@ BOOST_AUTO_TEST_CASE(pre_parse_test)
                 auto ec,
                 const auto&... parents) {
         try {
-            auto result = node.pre_parse(parsing::pre_parse_data{args}, parents.get()...);
+            auto result = node.pre_parse(parsing::pre_parse_data{args}, parents.get()...).extract();
             BOOST_CHECK(!ec);
 
             BOOST_CHECK_EQUAL(!match, !result);
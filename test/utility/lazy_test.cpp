@@ -0,0 +1,105 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "arg_router/utility/lazy.hpp"
+
+#include "test_helpers.hpp"
+
+#include <stdexcept>
+
+using namespace std::string_literals;
+using namespace arg_router;
+
+BOOST_AUTO_TEST_SUITE(utility_suite)
+
+BOOST_AUTO_TEST_SUITE(lazy_suite)
+
+BOOST_AUTO_TEST_CASE(constructor_test)
+{
+    const auto l1 = utility::lazy<int>{};
+    BOOST_CHECK(l1.has_value());
+    BOOST_CHECK_EQUAL(l1.get(), 0);
+
+    const auto l2 = utility::lazy<std::string>{"hello"s};
+    BOOST_CHECK(l2.has_value());
+    BOOST_CHECK_EQUAL(*l2, "hello");
+    BOOST_CHECK_EQUAL(l2->size(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(converter_test)
+{
+    auto num_calls = 0;
+    auto tokens = parsing::token_buffer{};
+    tokens.emplace_back(parsing::prefix_type::none, "hello");
+
+    const auto l = utility::lazy<std::string>{
+        [](const auto& buffer, const auto& ancestry) {
+            ++(*static_cast<int*>(const_cast<void*>(ancestry[0])));
+            return std::string{buffer.front().name};
+        },
+        tokens,
+        {{&num_calls}}};
+    BOOST_CHECK(!l.has_value());
+    BOOST_CHECK_EQUAL(num_calls, 0);
+
+    BOOST_CHECK_EQUAL(l.get(), "hello");
+    BOOST_CHECK(l.has_value());
+    BOOST_CHECK_EQUAL(num_calls, 1);
+
+    BOOST_CHECK_EQUAL(*l, "hello");
+    BOOST_CHECK_EQUAL(num_calls, 1);
+}
+
+BOOST_AUTO_TEST_CASE(throwing_converter_test)
+{
+    auto num_calls = 0;
+    const auto l = utility::lazy<int>{[](const auto&, const auto& ancestry) {
+                                          auto& num_calls =
+                                              *static_cast<int*>(const_cast<void*>(ancestry[0]));
+                                          if (++num_calls == 1) {
+                                              throw std::runtime_error{"Fail"};
+                                          }
+                                          return 42;
+                                      },
+                                      {},
+                                      {{&num_calls}}};
+
+    BOOST_CHECK_THROW([[maybe_unused]] const auto& value = l.get(), std::runtime_error);
+    BOOST_CHECK(!l.has_value());
+
+    // The converter is retried on the next access
+    BOOST_CHECK_EQUAL(l.get(), 42);
+    BOOST_CHECK_EQUAL(num_calls, 2);
+}
+
+BOOST_AUTO_TEST_CASE(move_test)
+{
+    auto num_calls = 0;
+    auto l1 = utility::lazy<int>{[](const auto&, const auto& ancestry) {
+                                     ++(*static_cast<int*>(const_cast<void*>(ancestry[0])));
+                                     return 42;
+                                 },
+                                 {},
+                                 {{&num_calls}}};
+
+    auto l2 = std::move(l1);
+    BOOST_CHECK(!l2.has_value());
+    BOOST_CHECK_EQUAL(l2.get(), 42);
+    BOOST_CHECK_EQUAL(num_calls, 1);
+
+    // The moved-from instance behaves as if default constructed
+    // NOLINTNEXTLINE(bugprone-use-after-move,hicpp-invalid-access-moved)
+    BOOST_CHECK_EQUAL(l1.get(), 0);
+    BOOST_CHECK_EQUAL(num_calls, 1);
+
+    l1 = std::move(l2);
+    BOOST_CHECK_EQUAL(l1.get(), 42);
+    // NOLINTNEXTLINE(bugprone-use-after-move,hicpp-invalid-access-moved)
+    BOOST_CHECK_EQUAL(l2.get(), 0);
+    BOOST_CHECK_EQUAL(num_calls, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,95 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "arg_router/utility/mapped_file.hpp"
+
+#include "test_helpers.hpp"
+
+#include <fstream>
+#include <iterator>
+
+using namespace arg_router;
+using namespace std::string_view_literals;
+
+namespace
+{
+[[nodiscard]] std::string_view to_string_view(span<char> data)
+{
+    return {data.data(), data.size()};
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(utility_suite)
+
+BOOST_AUTO_TEST_SUITE(mapped_file_suite)
+
+BOOST_AUTO_TEST_CASE(default_construction_test)
+{
+    const auto file = utility::mapped_file{};
+    BOOST_CHECK(file.data().empty());
+}
+
+BOOST_AUTO_TEST_CASE(open_test)
+{
+    const auto tmp = test::temp_file{"hello world\n"sv};
+
+    const auto file = utility::mapped_file::open(tmp.path());
+    BOOST_REQUIRE(file);
+    BOOST_CHECK_EQUAL(to_string_view(file->data()), "hello world\n");
+}
+
+BOOST_AUTO_TEST_CASE(open_empty_test)
+{
+    const auto tmp = test::temp_file{""sv};
+
+    const auto file = utility::mapped_file::open(tmp.path());
+    BOOST_REQUIRE(file);
+    BOOST_CHECK(file->data().empty());
+}
+
+BOOST_AUTO_TEST_CASE(open_missing_test)
+{
+    const auto file = utility::mapped_file::open("/this/file/does/not/exist");
+    BOOST_CHECK(!file);
+}
+
+BOOST_AUTO_TEST_CASE(copy_on_write_test)
+{
+    const auto tmp = test::temp_file{"hello"sv};
+    {
+        const auto file = utility::mapped_file::open(tmp.path());
+        BOOST_REQUIRE(file);
+        file->data()[0] = 'j';
+        BOOST_CHECK_EQUAL(to_string_view(file->data()), "jello");
+    }
+
+    // The modification is not written back to the file
+    auto stream = std::ifstream{tmp.path()};
+    const auto contents =
+        std::string{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+    BOOST_CHECK_EQUAL(contents, "hello");
+}
+
+BOOST_AUTO_TEST_CASE(move_test)
+{
+    const auto tmp = test::temp_file{"hello"sv};
+
+    auto file = utility::mapped_file::open(tmp.path());
+    BOOST_REQUIRE(file);
+    const auto* data = file->data().data();
+
+    auto moved = std::move(*file);
+    BOOST_CHECK(file->data().empty());  // NOLINT(bugprone-use-after-move)
+    BOOST_CHECK_EQUAL(moved.data().data(), data);
+    BOOST_CHECK_EQUAL(to_string_view(moved.data()), "hello");
+
+    auto assigned = utility::mapped_file{};
+    assigned = std::move(moved);
+    BOOST_CHECK(moved.data().empty());  // NOLINT(bugprone-use-after-move)
+    BOOST_CHECK_EQUAL(assigned.data().data(), data);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
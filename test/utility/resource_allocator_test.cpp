@@ -0,0 +1,166 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "arg_router/utility/resource_allocator.hpp"
+#include "arg_router/utility/unsafe_any.hpp"
+
+#include "test_helpers.hpp"
+
+#include <array>
+#include <optional>
+
+using namespace arg_router;
+
+namespace
+{
+template <typename T>
+using resource_vector = std::vector<T, utility::resource_allocator<T>>;
+
+using resource_string =
+    std::basic_string<char, std::char_traits<char>, utility::resource_allocator<char>>;
+
+using test::counting_resource;
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(utility_suite)
+
+BOOST_AUTO_TEST_SUITE(resource_allocator_suite)
+
+BOOST_AUTO_TEST_CASE(scope_test)
+{
+    auto outer = counting_resource{};
+    auto inner = counting_resource{};
+
+    BOOST_CHECK_EQUAL(utility::current_memory_resource(), std::pmr::get_default_resource());
+    {
+        const auto outer_scope = utility::memory_resource_scope{outer};
+        BOOST_CHECK_EQUAL(utility::current_memory_resource(), &outer);
+        {
+            const auto inner_scope = utility::memory_resource_scope{inner};
+            BOOST_CHECK_EQUAL(utility::current_memory_resource(), &inner);
+        }
+        BOOST_CHECK_EQUAL(utility::current_memory_resource(), &outer);
+    }
+    BOOST_CHECK_EQUAL(utility::current_memory_resource(), std::pmr::get_default_resource());
+}
+
+BOOST_AUTO_TEST_CASE(allocation_test)
+{
+    auto resource = counting_resource{};
+
+    auto v = std::optional<resource_vector<int>>{};
+    {
+        const auto scope = utility::memory_resource_scope{resource};
+        v.emplace(42, 3);
+    }
+    BOOST_CHECK_EQUAL(v->get_allocator().resource(), &resource);
+    BOOST_CHECK_GE(resource.current_bytes, 42 * sizeof(int));
+
+    // Memory goes back to the original resource after the scope has ended
+    v->push_back(4);
+    v.reset();
+    BOOST_CHECK_EQUAL(resource.current_bytes, 0);
+
+    // Copies use the current resource
+    auto other_resource = counting_resource{};
+    const auto original = resource_vector<int>(42, 3, utility::resource_allocator<int>{&resource});
+    {
+        const auto scope = utility::memory_resource_scope{other_resource};
+        const auto copy = original;
+        BOOST_CHECK_EQUAL(copy.get_allocator().resource(), &other_resource);
+        BOOST_CHECK_GE(other_resource.current_bytes, 42 * sizeof(int));
+    }
+    BOOST_CHECK_EQUAL(other_resource.current_bytes, 0);
+}
+
+BOOST_AUTO_TEST_CASE(monotonic_buffer_test)
+{
+    auto buffer = std::array<std::byte, 1024>{};
+    auto arena = std::pmr::monotonic_buffer_resource{buffer.data(),
+                                                     buffer.size(),
+                                                     std::pmr::null_memory_resource()};
+    auto resource = counting_resource{&arena};
+
+    for (auto i = 0; i < 3; ++i) {
+        {
+            const auto scope = utility::memory_resource_scope{resource};
+            auto v = resource_vector<int>{};
+            v.reserve(42);
+            for (auto j = 0; j < 42; ++j) {
+                v.push_back(j);
+            }
+
+            BOOST_CHECK_GE(static_cast<const void*>(v.data()),
+                           static_cast<const void*>(buffer.data()));
+            BOOST_CHECK_LT(static_cast<const void*>(v.data()),
+                           static_cast<const void*>(buffer.data() + buffer.size()));
+        }
+        BOOST_CHECK_EQUAL(resource.current_bytes, 0);
+
+        // Release it all in one shot so the next iteration can use the whole buffer again
+        arena.release();
+    }
+}
+
+BOOST_AUTO_TEST_CASE(unsafe_any_test)
+{
+    auto resource = counting_resource{};
+    const auto value = resource_string(128, 'a');
+
+    auto any = utility::unsafe_any{};
+    {
+        const auto scope = utility::memory_resource_scope{resource};
+        any = utility::unsafe_any{value, utility::resource_allocator<resource_string>{}};
+    }
+    BOOST_CHECK_GE(resource.current_bytes, sizeof(resource_string) + value.size());
+    BOOST_CHECK_EQUAL(any.get<resource_string>(), value);
+
+    // Copies use the current resource, which is now the default one
+    const auto before = resource.allocated_bytes;
+    {
+        const auto copy = any;
+        BOOST_CHECK_EQUAL(copy.get<resource_string>(), value);
+    }
+    BOOST_CHECK_EQUAL(resource.allocated_bytes, before);
+
+    any = utility::unsafe_any{};
+    BOOST_CHECK_EQUAL(resource.current_bytes, 0);
+}
+
+BOOST_AUTO_TEST_SUITE(death_suite)
+
+BOOST_AUTO_TEST_CASE(root_parse_requires_resource_allocator_test)
+{
+    test::death_test_compile(
+        R"(
+#include "arg_router/flag.hpp"
+#include "arg_router/mode.hpp"
+#include "arg_router/policy/long_name.hpp"
+#include "arg_router/policy/router.hpp"
+#include "arg_router/policy/validator.hpp"
+#include "arg_router/root.hpp"
+
+#include <memory_resource>
+
+using namespace arg_router;
+
+int main() {
+    const auto r = root(mode(flag(policy::long_name<AR_STRING("hello")>),
+                             policy::router{[](bool) {}}),
+                        policy::validation::default_validator);
+
+    auto arena = std::pmr::monotonic_buffer_resource{};
+    r.parse(vector<parsing::token_type>{}, arena);
+    return 0;
+}
+    )",
+        "Per-parse memory resources require AR_ALLOCATOR to be "
+        "arg_router::utility::resource_allocator");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,4 +1,4 @@
-// Copyright (C) 2022 by Camden Mannett.
+// Copyright (C) 2022-2023 by Camden Mannett.
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
 
@@ -7,6 +7,7 @@
 #include "test_helpers.hpp"
 
 using namespace arg_router;
+using namespace std::string_literals;
 
 BOOST_AUTO_TEST_SUITE(utility_suite)
 
@@ -100,6 +101,10 @@ BOOST_AUTO_TEST_CASE(exception_test)
         const auto r_ptr = r.get_if();
         BOOST_CHECK(!r_ptr);
 
+        const auto e_ptr = r.get_error_if();
+        BOOST_REQUIRE(e_ptr);
+        BOOST_CHECK_EQUAL(e_ptr->what(), message);
+
         BOOST_CHECK_EXCEPTION(r.extract(), std::runtime_error, [&](const auto& e) {
             return e.what() == message;
         });
@@ -149,6 +154,29 @@ BOOST_AUTO_TEST_CASE(equality_test)
                    });
 }
 
+BOOST_AUTO_TEST_CASE(void_test)
+{
+    auto r = utility::result<void, std::runtime_error>{};
+    BOOST_CHECK(r.has_result());
+    BOOST_CHECK(!r.has_error());
+    BOOST_CHECK(r);
+    BOOST_CHECK(!r.get_error_if());
+    r.throw_exception();
+
+    r = std::runtime_error{"test"};
+    BOOST_CHECK(!r.has_result());
+    BOOST_CHECK(r.has_error());
+    BOOST_CHECK(!r);
+
+    const auto e_ptr = r.get_error_if();
+    BOOST_REQUIRE(e_ptr);
+    BOOST_CHECK_EQUAL(e_ptr->what(), "test"s);
+
+    BOOST_CHECK_EXCEPTION(r.throw_exception(), std::runtime_error, [&](const auto& e) {
+        return e.what() == "test"s;
+    });
+}
+
 BOOST_AUTO_TEST_SUITE(death_suite)
 
 BOOST_AUTO_TEST_CASE(same_result_and_exception_types_test)
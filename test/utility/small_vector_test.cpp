@@ -0,0 +1,258 @@
+// Copyright (C) 2023 by Camden Mannett.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "arg_router/utility/resource_allocator.hpp"
+#include "arg_router/utility/small_vector.hpp"
+
+#include "test_helpers.hpp"
+
+#include <vector>
+
+using namespace arg_router;
+
+namespace
+{
+using sv_type = utility::small_vector<int, 2>;
+
+template <typename T>
+class copy_propagating_allocator : public utility::resource_allocator<T>
+{
+public:
+    using propagate_on_container_copy_assignment = std::true_type;
+
+    using utility::resource_allocator<T>::resource_allocator;
+};
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(small_vector_suite)
+
+BOOST_AUTO_TEST_CASE(default_construction)
+{
+    auto v = sv_type{};
+    BOOST_CHECK(v.empty());
+    BOOST_CHECK_EQUAL(v.size(), 0);
+    BOOST_CHECK_EQUAL(v.capacity(), 2);
+    BOOST_CHECK(v.is_inline());
+    BOOST_CHECK(v.begin() == v.end());
+}
+
+BOOST_AUTO_TEST_CASE(push_back_test)
+{
+    auto v = sv_type{};
+    v.push_back(1);
+    v.emplace_back(2);
+    BOOST_CHECK(v.is_inline());
+    BOOST_CHECK_EQUAL(v.size(), 2);
+    BOOST_CHECK_EQUAL(v.front(), 1);
+    BOOST_CHECK_EQUAL(v.back(), 2);
+
+    v.push_back(3);
+    BOOST_CHECK(!v.is_inline());
+    BOOST_CHECK_GE(v.capacity(), 3);
+    BOOST_CHECK(v == (std::vector{1, 2, 3}));
+
+    // Push back an existing element that will be moved by the reallocation
+    v.push_back(v.front());
+    v.push_back(v.back());
+    BOOST_CHECK(v == (std::vector{1, 2, 3, 1, 1}));
+
+    v.pop_back();
+    BOOST_CHECK(v == (std::vector{1, 2, 3, 1}));
+}
+
+BOOST_AUTO_TEST_CASE(insert_test)
+{
+    auto f = [](auto initial, auto pos, auto values, auto expected) {
+        auto v = sv_type(initial.begin(), initial.end());
+        const auto it = v.insert(v.begin() + pos, values.begin(), values.end());
+        BOOST_CHECK_EQUAL(std::distance(v.begin(), it), pos);
+        BOOST_CHECK(v == expected);
+    };
+
+    test::data_set(f,
+                   {
+                       std::tuple{std::vector<int>{}, 0, std::vector<int>{}, std::vector<int>{}},
+                       std::tuple{std::vector<int>{}, 0, std::vector{1}, std::vector{1}},
+                       std::tuple{std::vector{1}, 0, std::vector{2}, std::vector{2, 1}},
+                       std::tuple{std::vector{1}, 1, std::vector{2}, std::vector{1, 2}},
+                       std::tuple{std::vector{1, 2}, 1, std::vector{3, 4}, std::vector{1, 3, 4, 2}},
+                       std::tuple{std::vector{1, 2, 3}, 3, std::vector{4}, std::vector{1, 2, 3, 4}},
+                   });
+}
+
+BOOST_AUTO_TEST_CASE(self_insert_test)
+{
+    auto v = sv_type{1, 2};
+    v.insert(v.begin(), v.begin(), v.end());
+    BOOST_CHECK(v == (std::vector{1, 2, 1, 2}));
+
+    v.insert(v.end(), v[0]);
+    BOOST_CHECK(v == (std::vector{1, 2, 1, 2, 1}));
+}
+
+BOOST_AUTO_TEST_CASE(erase_test)
+{
+    auto f = [](auto initial, auto first, auto last, auto expected) {
+        auto v = sv_type(initial.begin(), initial.end());
+        const auto it = v.erase(v.begin() + first, v.begin() + last);
+        BOOST_CHECK_EQUAL(std::distance(v.begin(), it), first);
+        BOOST_CHECK(v == expected);
+    };
+
+    test::data_set(f,
+                   {
+                       std::tuple{std::vector{1}, 0, 1, std::vector<int>{}},
+                       std::tuple{std::vector{1, 2}, 0, 1, std::vector{2}},
+                       std::tuple{std::vector{1, 2}, 1, 2, std::vector{1}},
+                       std::tuple{std::vector{1, 2, 3, 4}, 1, 3, std::vector{1, 4}},
+                       std::tuple{std::vector{1, 2, 3, 4}, 0, 4, std::vector<int>{}},
+                   });
+}
+
+BOOST_AUTO_TEST_CASE(copy_test)
+{
+    auto f = [](auto initial) {
+        const auto v = sv_type(initial.begin(), initial.end());
+
+        auto copy = v;
+        BOOST_CHECK(copy == initial);
+        BOOST_CHECK(v == initial);
+        BOOST_CHECK_EQUAL(copy.is_inline(), initial.size() <= 2);
+
+        auto assigned = sv_type{42};
+        assigned = v;
+        BOOST_CHECK(assigned == initial);
+    };
+
+    test::data_set(f,
+                   {
+                       std::tuple{std::vector<int>{}},
+                       std::tuple{std::vector{1}},
+                       std::tuple{std::vector{1, 2}},
+                       std::tuple{std::vector{1, 2, 3}},
+                   });
+}
+
+BOOST_AUTO_TEST_CASE(move_test)
+{
+    auto f = [](auto initial) {
+        auto v = sv_type(initial.begin(), initial.end());
+        const auto* data = v.data();
+
+        auto moved = std::move(v);
+        BOOST_CHECK(moved == initial);
+        BOOST_CHECK(v.empty());  // NOLINT(bugprone-use-after-move)
+        BOOST_CHECK(v.is_inline());
+        if (initial.size() > 2) {
+            // Heap storage is taken rather than copied
+            BOOST_CHECK_EQUAL(moved.data(), data);
+        }
+
+        auto assigned = sv_type{4, 5, 6};
+        assigned = std::move(moved);
+        BOOST_CHECK(assigned == initial);
+        BOOST_CHECK(moved.empty());  // NOLINT(bugprone-use-after-move)
+    };
+
+    test::data_set(f,
+                   {
+                       std::tuple{std::vector<int>{}},
+                       std::tuple{std::vector{1}},
+                       std::tuple{std::vector{1, 2}},
+                       std::tuple{std::vector{1, 2, 3}},
+                   });
+}
+
+BOOST_AUTO_TEST_CASE(stateful_allocator_move_assignment_test)
+{
+    auto resource_a = test::counting_resource{};
+    auto resource_b = test::counting_resource{};
+
+    // Propagating allocator, so the heap storage and allocator are taken together
+    {
+        using vector_type = utility::small_vector<int, 2, utility::resource_allocator<int>>;
+
+        auto a = vector_type{{1, 2, 3}, utility::resource_allocator<int>{&resource_a}};
+        const auto* data = a.data();
+
+        auto b = vector_type{utility::resource_allocator<int>{&resource_b}};
+        b = std::move(a);
+        BOOST_CHECK(b == (std::vector{1, 2, 3}));
+        BOOST_CHECK_EQUAL(b.data(), data);
+        BOOST_CHECK_EQUAL(b.get_allocator().resource(), &resource_a);
+        BOOST_CHECK_EQUAL(resource_b.allocated_bytes, 0u);
+    }
+    BOOST_CHECK_EQUAL(resource_a.current_bytes, 0u);
+    BOOST_CHECK_EQUAL(resource_b.current_bytes, 0u);
+
+    // Non-propagating allocator that compares unequal, so the elements are copied
+    {
+        using vector_type = utility::small_vector<int, 2, std::pmr::polymorphic_allocator<int>>;
+
+        auto a = vector_type{{1, 2, 3}, std::pmr::polymorphic_allocator<int>{&resource_a}};
+        const auto* data = a.data();
+
+        auto b = vector_type{std::pmr::polymorphic_allocator<int>{&resource_b}};
+        b = std::move(a);
+        BOOST_CHECK(b == (std::vector{1, 2, 3}));
+        BOOST_CHECK_NE(b.data(), data);
+        BOOST_CHECK_EQUAL(b.get_allocator().resource(), &resource_b);
+        BOOST_CHECK(a.empty());  // NOLINT(bugprone-use-after-move)
+        BOOST_CHECK_GT(resource_b.current_bytes, 0u);
+    }
+    BOOST_CHECK_EQUAL(resource_a.current_bytes, 0u);
+    BOOST_CHECK_EQUAL(resource_b.current_bytes, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(stateful_allocator_copy_assignment_test)
+{
+    auto resource_a = test::counting_resource{};
+    auto resource_b = test::counting_resource{};
+
+    // Propagating allocator, so the existing heap storage is returned before the allocator is
+    // taken
+    {
+        using vector_type = utility::small_vector<int, 2, copy_propagating_allocator<int>>;
+
+        const auto a = vector_type{{1, 2, 3}, copy_propagating_allocator<int>{&resource_a}};
+        auto b = vector_type{{4, 5, 6, 7}, copy_propagating_allocator<int>{&resource_b}};
+        BOOST_CHECK_GT(resource_b.current_bytes, 0u);
+
+        b = a;
+        BOOST_CHECK(b == (std::vector{1, 2, 3}));
+        BOOST_CHECK_NE(b.data(), a.data());
+        BOOST_CHECK_EQUAL(b.get_allocator().resource(), &resource_a);
+        BOOST_CHECK_EQUAL(resource_b.current_bytes, 0u);
+    }
+    BOOST_CHECK_EQUAL(resource_a.current_bytes, 0u);
+    BOOST_CHECK_EQUAL(resource_b.current_bytes, 0u);
+
+    // Non-propagating allocator, so the elements are copied into this instance's storage
+    {
+        using vector_type = utility::small_vector<int, 2, std::pmr::polymorphic_allocator<int>>;
+
+        const auto a = vector_type{{1, 2, 3}, std::pmr::polymorphic_allocator<int>{&resource_a}};
+        auto b = vector_type{std::pmr::polymorphic_allocator<int>{&resource_b}};
+
+        b = a;
+        BOOST_CHECK(b == (std::vector{1, 2, 3}));
+        BOOST_CHECK_EQUAL(b.get_allocator().resource(), &resource_b);
+        BOOST_CHECK_GT(resource_b.current_bytes, 0u);
+    }
+    BOOST_CHECK_EQUAL(resource_a.current_bytes, 0u);
+    BOOST_CHECK_EQUAL(resource_b.current_bytes, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(equality_test)
+{
+    const auto v = sv_type{1, 2, 3};
+    BOOST_CHECK(v == (sv_type{1, 2, 3}));
+    BOOST_CHECK(v != (sv_type{1, 2}));
+    BOOST_CHECK(v == (std::vector{1, 2, 3}));
+    BOOST_CHECK((std::vector{1, 2, 3}) == v);
+    BOOST_CHECK(v != (std::vector{1, 2, 4}));
+    BOOST_CHECK((std::vector{1, 2}) != v);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
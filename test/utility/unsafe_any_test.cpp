@@ -1,4 +1,4 @@
-// Copyright (C) 2022 by Camden Mannett.
+// Copyright (C) 2022-2023 by Camden Mannett.
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
 
@@ -135,6 +135,106 @@ BOOST_AUTO_TEST_CASE(move_construction_test)
     BOOST_CHECK(any2.has_value());
 }
 
+BOOST_AUTO_TEST_CASE(size_test)
+{
+    static_assert(sizeof(utility::unsafe_any) == (sizeof(std::string_view) + sizeof(void*)),
+                  "unsafe_any should only be the storage plus a pointer");
+}
+
+BOOST_AUTO_TEST_CASE(external_storage_copy_and_move_test)
+{
+    const auto value = std::string(128, 'a');
+
+    auto any1 = utility::unsafe_any{value};
+    auto any2 = any1;
+    BOOST_REQUIRE(any2.has_value());
+    BOOST_CHECK_NE(&any1.get<std::string>(), &any2.get<std::string>());
+    BOOST_CHECK_EQUAL(any2.get<std::string>(), value);
+
+    // Moving just transfers the pointer
+    const auto* address = &any2.get<std::string>();
+    auto any3 = std::move(any2);
+    BOOST_CHECK(!any2.has_value());
+    BOOST_REQUIRE(any3.has_value());
+    BOOST_CHECK_EQUAL(&any3.get<std::string>(), address);
+
+    any3 = 42;
+    BOOST_CHECK_EQUAL(any3.get<int>(), 42);
+    BOOST_CHECK_EQUAL(any1.get<std::string>(), value);
+}
+
+BOOST_AUTO_TEST_CASE(internal_storage_non_trivial_test)
+{
+    struct tracker {
+        explicit tracker(int& count) : count_{&count} { ++(*count_); }
+        tracker(const tracker& other) : count_{other.count_} { ++(*count_); }
+        tracker(tracker&& other) noexcept : count_{std::exchange(other.count_, nullptr)} {}
+        tracker& operator=(const tracker&) = delete;
+        tracker& operator=(tracker&&) = delete;
+        ~tracker()
+        {
+            if (count_) {
+                --(*count_);
+            }
+        }
+
+        int* count_;
+    };
+
+    auto count = 0;
+    {
+        auto any1 = utility::unsafe_any{tracker{count}};
+        BOOST_CHECK_EQUAL(count, 1);
+
+        auto any2 = any1;
+        BOOST_CHECK_EQUAL(count, 2);
+
+        auto any3 = std::move(any1);
+        BOOST_CHECK(!any1.has_value());
+        BOOST_CHECK_EQUAL(count, 2);
+
+        swap(any1, any3);
+        BOOST_CHECK(any1.has_value());
+        BOOST_CHECK(!any3.has_value());
+        BOOST_CHECK_EQUAL(count, 2);
+
+        any2 = utility::unsafe_any{};
+        BOOST_CHECK_EQUAL(count, 1);
+    }
+    BOOST_CHECK_EQUAL(count, 0);
+}
+
+BOOST_AUTO_TEST_CASE(throwing_move_external_storage_test)
+{
+    struct throwing_move {
+        explicit throwing_move(int v) : value{v} {}
+        throwing_move(const throwing_move&) = default;
+        // NOLINTNEXTLINE(performance-noexcept-move-constructor)
+        throwing_move(throwing_move&& other) : value{other.value}
+        {
+            if (value < 0) {
+                throw std::runtime_error{"Negative"};
+            }
+        }
+        throwing_move& operator=(const throwing_move&) = delete;
+        throwing_move& operator=(throwing_move&&) = delete;
+        ~throwing_move() = default;
+
+        int value;
+    };
+    static_assert(sizeof(throwing_move) <= sizeof(std::string_view));
+
+    // Small enough for the internal storage, but moving the any must not move the value
+    auto any1 = utility::unsafe_any{throwing_move{42}};
+    const auto* address = &any1.get<throwing_move>();
+
+    auto any2 = std::move(any1);
+    BOOST_CHECK(!any1.has_value());
+    BOOST_REQUIRE(any2.has_value());
+    BOOST_CHECK_EQUAL(&any2.get<throwing_move>(), address);
+    BOOST_CHECK_EQUAL(any2.get<throwing_move>().value, 42);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()